@@ -0,0 +1,187 @@
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#include <QJsonArray>
+#include <QThread>
+#include <QTimerEvent>
+
+#include <algorithm>
+
+#include "MinerBenchmark.h"
+#include "Miner/CpuTopology.h"
+#include "Miner/Worker.h"
+
+namespace WalletGUI {
+
+namespace {
+
+const int BLOB_SIZE = 76;
+const quint32 ACCEPT_ALL_TARGET = 0xffffffff;
+
+QByteArray makeSyntheticBlob(quint32 _jobCount) {
+  QByteArray blob(BLOB_SIZE, 0);
+  for (int i = 0; i < BLOB_SIZE; ++i) {
+    blob[i] = static_cast<char>((i * 31 + _jobCount * 17) & 0xff);
+  }
+
+  return blob;
+}
+
+QJsonObject makeLatencySummary(QVector<double> _latencies) {
+  QJsonObject result;
+  result.insert("samples", _latencies.size());
+  if (_latencies.isEmpty()) {
+    return result;
+  }
+
+  std::sort(_latencies.begin(), _latencies.end());
+  double sum = 0;
+  for (double latency : _latencies) {
+    sum += latency;
+  }
+
+  result.insert("min", _latencies.first());
+  result.insert("avg", sum / _latencies.size());
+  result.insert("p50", _latencies[(_latencies.size() - 1) / 2]);
+  result.insert("p99", _latencies[(_latencies.size() - 1) * 99 / 100]);
+  result.insert("max", _latencies.last());
+  return result;
+}
+
+}
+
+MinerBenchmark::MinerBenchmark(const MinerBenchmarkOptions& _options, QObject* _parent) : QObject(_parent),
+  m_options(_options), m_alternateProbability(0), m_nonceBatchSize(_options.nonceBatchSize),
+  m_dutyCycle(100), m_noncePartition(NoncePartition().pack()), m_jobCount(0), m_currentJobGeneration(0), m_jobPublishTime(0),
+  m_workerJobCounts(_options.threadCount, 0), m_startHashCounts(_options.threadCount, 0),
+  m_finishHashCounts(_options.threadCount, 0), m_elapsedMsecs(0), m_jobTimerId(-1), m_durationTimerId(-1) {
+}
+
+MinerBenchmark::~MinerBenchmark() {
+  for (auto& workerThread : m_workerThreadList) {
+    workerThread.second->stop();
+    workerThread.first->quit();
+    workerThread.first->wait();
+    delete dynamic_cast<QObject*>(workerThread.second);
+  }
+}
+
+void MinerBenchmark::start() {
+  QList<int> placement;
+  if (m_options.pinThreads) {
+    placement = CpuTopology::instance().getPlacement(m_options.threadCount, QList<int>());
+  }
+
+  for (quint32 i = 0; i < m_options.threadCount; ++i) {
+    ShareQueue* shareQueue = new ShareQueue(this);
+    connect(shareQueue, &ShareQueue::sharesAvailableSignal, this, [this, i]() { sharesAvailable(i); }, Qt::QueuedConnection);
+    m_shareQueues.append(shareQueue);
+    const WorkSource source = {&m_mainJobSlot, &m_alternateJobSlot, shareQueue, &m_alternateShareQueue, &m_alternateProbability};
+    Worker* worker = new Worker(source, m_nonceBatchSize, m_dutyCycle, m_noncePartition, nullptr);
+    worker->setCpu(placement.value(i, -1));
+    QThread* thread = new QThread(this);
+    connect(thread, &QThread::started, worker, &Worker::start);
+    worker->moveToThread(thread);
+    m_workerThreadList.append(qMakePair(thread, worker));
+  }
+
+  m_clock.start();
+  publishJob();
+  for (int i = 0; i < m_workerThreadList.size(); ++i) {
+    m_startHashCounts[i] = m_workerThreadList[i].second->getHashCount();
+    m_workerThreadList[i].first->start();
+  }
+
+  if (m_options.jobSwitchIntervalMsecs > 0) {
+    m_jobTimerId = startTimer(m_options.jobSwitchIntervalMsecs, Qt::PreciseTimer);
+  }
+
+  m_durationTimerId = startTimer(m_options.durationMsecs, Qt::PreciseTimer);
+}
+
+QJsonObject MinerBenchmark::getResult() const {
+  QJsonObject result;
+  result.insert("threads", static_cast<int>(m_options.threadCount));
+  result.insert("nonce_batch_size", static_cast<int>(m_options.nonceBatchSize));
+  result.insert("pinned", m_options.pinThreads && CpuTopology::isPinningSupported());
+  result.insert("duration_ms", static_cast<double>(m_elapsedMsecs));
+  result.insert("jobs", static_cast<int>(m_jobCount));
+
+  double totalHashRate = 0;
+  QJsonArray threadHashRates;
+  for (int i = 0; i < m_workerThreadList.size(); ++i) {
+    const double hashRate = m_elapsedMsecs > 0 ? (m_finishHashCounts[i] - m_startHashCounts[i]) * 1000.0 / m_elapsedMsecs : 0;
+    totalHashRate += hashRate;
+    threadHashRates.append(hashRate);
+  }
+
+  result.insert("total_hashrate", totalHashRate);
+  result.insert("thread_hashrates", threadHashRates);
+  result.insert("job_switch_latency_ms", makeLatencySummary(m_jobSwitchLatencies));
+  return result;
+}
+
+void MinerBenchmark::timerEvent(QTimerEvent* _event) {
+  if (_event->timerId() == m_jobTimerId) {
+    publishJob();
+    return;
+  } else if (_event->timerId() == m_durationTimerId) {
+    finish();
+    return;
+  }
+
+  QObject::timerEvent(_event);
+}
+
+void MinerBenchmark::publishJob() {
+  ++m_jobCount;
+  m_jobPublishTime = ShareQueue::getTimestamp();
+  m_mainJobSlot.publish({QString("bench-%1").arg(m_jobCount), ACCEPT_ALL_TARGET, makeSyntheticBlob(m_jobCount), 0,
+    HashAlgorithm::CRYPTONIGHT_V1});
+  m_currentJobGeneration = m_mainJobSlot.getGeneration();
+}
+
+void MinerBenchmark::sharesAvailable(int _workerIndex) {
+  ShareQueue* shareQueue = m_shareQueues[_workerIndex];
+  shareQueue->takeNotification();
+  ShareRecord share;
+  while (shareQueue->pop(share)) {
+    if (share.jobGeneration != m_currentJobGeneration || m_workerJobCounts[_workerIndex] == m_jobCount) {
+      continue;
+    }
+
+    // The first job only measures thread start-up, so only later switches are recorded.
+    if (m_jobCount > 1) {
+      m_jobSwitchLatencies.append((share.foundTime - m_jobPublishTime) / 1e6);
+    }
+
+    m_workerJobCounts[_workerIndex] = m_jobCount;
+  }
+}
+
+void MinerBenchmark::finish() {
+  killTimer(m_durationTimerId);
+  m_durationTimerId = -1;
+  if (m_jobTimerId != -1) {
+    killTimer(m_jobTimerId);
+    m_jobTimerId = -1;
+  }
+
+  m_elapsedMsecs = m_clock.elapsed();
+  for (int i = 0; i < m_workerThreadList.size(); ++i) {
+    m_finishHashCounts[i] = m_workerThreadList[i].second->getHashCount();
+  }
+
+  for (auto& workerThread : m_workerThreadList) {
+    workerThread.second->stop();
+    workerThread.first->quit();
+  }
+
+  for (auto& workerThread : m_workerThreadList) {
+    workerThread.first->wait();
+  }
+
+  Q_EMIT finishedSignal();
+}
+
+}
@@ -0,0 +1,79 @@
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#pragma once
+
+#include <QElapsedTimer>
+#include <QJsonObject>
+#include <QList>
+#include <QObject>
+#include <QVector>
+
+#include <atomic>
+
+#include "IMinerWorker.h"
+#include "Miner/JobSlot.h"
+#include "Miner/ShareQueue.h"
+
+class QThread;
+
+namespace WalletGUI {
+
+struct MinerBenchmarkOptions {
+  quint32 threadCount;
+  quint32 nonceBatchSize;
+  quint32 durationMsecs;
+  quint32 jobSwitchIntervalMsecs;
+  bool pinThreads;
+};
+
+// Runs the mining workers against synthetic jobs without any pool connection. Every worker gets its
+// own share queue and the job target accepts every hash, so each worker reports a share per hash; the
+// first share a worker finds for a newly published job marks the end of its job switch, which
+// therefore includes one hashing round.
+class MinerBenchmark : public QObject {
+  Q_OBJECT
+  Q_DISABLE_COPY(MinerBenchmark)
+
+public:
+  MinerBenchmark(const MinerBenchmarkOptions& _options, QObject* _parent);
+  ~MinerBenchmark();
+
+  void start();
+  QJsonObject getResult() const;
+
+protected:
+  void timerEvent(QTimerEvent* _event) override;
+
+private:
+  const MinerBenchmarkOptions m_options;
+  JobSlot m_mainJobSlot;
+  JobSlot m_alternateJobSlot;
+  ShareQueue m_alternateShareQueue;
+  QList<ShareQueue*> m_shareQueues;
+  std::atomic<quint32> m_alternateProbability;
+  std::atomic<quint32> m_nonceBatchSize;
+  std::atomic<quint32> m_dutyCycle;
+  std::atomic<quint64> m_noncePartition;
+  QList<QPair<QThread*, IMinerWorker*> > m_workerThreadList;
+  QElapsedTimer m_clock;
+  quint32 m_jobCount;
+  quint64 m_currentJobGeneration;
+  qint64 m_jobPublishTime;
+  QVector<quint32> m_workerJobCounts;
+  QVector<quint64> m_startHashCounts;
+  QVector<quint64> m_finishHashCounts;
+  QVector<double> m_jobSwitchLatencies;
+  qint64 m_elapsedMsecs;
+  int m_jobTimerId;
+  int m_durationTimerId;
+
+  void publishJob();
+  void sharesAvailable(int _workerIndex);
+  void finish();
+
+Q_SIGNALS:
+  void finishedSignal();
+};
+
+}
@@ -0,0 +1,399 @@
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonValue>
+#include <QScopedPointer>
+#include <QTest>
+
+#include <limits>
+
+#include "WalletBenchmark.h"
+#include "JsonRpc/JsonRpcObject.h"
+#include "JsonRpc/JsonRpcObjectFactory.h"
+#include "addressbookmanager.h"
+#include "common.h"
+#include "rpcapi.h"
+#include "walletmodel.h"
+
+namespace WalletGUI {
+
+namespace {
+
+// Page size the wallet asks walletd for, see RpcApi::GetTransfers::Request::desired_transactions_count.
+const int HISTORY_PAGE_SIZE = 50;
+const RpcApi::Height TOP_BLOCK_HEIGHT = 20000000;
+// Far enough below the top block for the history to count as confirmed.
+const RpcApi::Height HISTORY_TOP_HEIGHT = TOP_BLOCK_HEIGHT - 1000;
+const RpcApi::Amount BLOCK_REWARD = 123456789012345;
+const quint64 BLOCK_TIME_SECONDS = 120;
+const quint64 FIRST_BLOCK_TIMESTAMP = 1514764800;
+const quint32 COINBASE_UNLOCK_WINDOW = 10;
+const quint32 COINBASE_BINARY_SIZE = 198;
+
+QString makeHash(quint64 _seed) {
+  return QString("%1").arg(_seed * Q_UINT64_C(0x9e3779b97f4a7c15), 16, 16, QChar('0')).repeated(4);
+}
+
+QString makeAddress(quint64 _seed) {
+  return "gd" + makeHash(_seed) + makeHash(~_seed).left(29);
+}
+
+QDateTime makeTimestamp(RpcApi::Height _height) {
+  return QDateTime::fromTime_t(FIRST_BLOCK_TIMESTAMP + _height * BLOCK_TIME_SECONDS).toUTC();
+}
+
+RpcApi::Output makeOutput(RpcApi::Height _height, quint32 _index, const QString& _address, RpcApi::Amount _amount) {
+  RpcApi::Output output;
+  output.amount = _amount;
+  output.public_key = makeHash(_height * 16 + _index + 1);
+  output.global_index = _height * 16 + _index;
+  output.unlock_time = _height + COINBASE_UNLOCK_WINDOW;
+  output.index_in_transaction = _index;
+  output.height = _height;
+  output.key_image = makeHash(_height * 16 + _index + 2);
+  output.transaction_public_key = makeHash(_height + 3);
+  output.address = _address;
+  return output;
+}
+
+// A coinbase transaction paying the block reward to _transferCount addresses.
+RpcApi::Transaction makeTransaction(RpcApi::Height _height, int _transferCount, int _outputsPerTransfer) {
+  RpcApi::Transaction transaction;
+  transaction.unlock_time = _height + COINBASE_UNLOCK_WINDOW;
+  transaction.hash = makeHash(_height);
+  transaction.public_key = makeHash(_height + 3);
+  transaction.extra = "01" + transaction.public_key;
+  transaction.coinbase = true;
+  transaction.amount = BLOCK_REWARD;
+  transaction.block_height = _height;
+  transaction.block_hash = makeHash(~static_cast<quint64>(_height));
+  transaction.timestamp = makeTimestamp(_height);
+  transaction.binary_size = COINBASE_BINARY_SIZE;
+  for (int i = 0; i < _transferCount; ++i) {
+    RpcApi::Transfer transfer;
+    transfer.address = makeAddress(i);
+    transfer.amount = BLOCK_REWARD / _transferCount;
+    for (int j = 0; j < _outputsPerTransfer; ++j) {
+      transfer.outputs.append(makeOutput(_height, i * _outputsPerTransfer + j, transfer.address, transfer.amount / _outputsPerTransfer));
+    }
+
+    transaction.transfers.append(transfer);
+  }
+
+  return transaction;
+}
+
+// BlockHeader has no toJson(), so the header is written the way walletd sends it.
+QVariantMap makeBlockHeaderJson(RpcApi::Height _height) {
+  QVariantMap json;
+  json.insert("major_version", 4);
+  json.insert("minor_version", 0);
+  json.insert("timestamp", makeTimestamp(_height).toTime_t());
+  json.insert("previous_block_hash", makeHash(~static_cast<quint64>(_height - 1)));
+  json.insert("nonce", _height * 7919);
+  json.insert("height", _height);
+  json.insert("hash", makeHash(~static_cast<quint64>(_height)));
+  json.insert("reward", BLOCK_REWARD);
+  json.insert("cumulative_difficulty", Q_UINT64_C(1000000) * _height);
+  json.insert("difficulty", 1000000);
+  json.insert("base_reward", BLOCK_REWARD);
+  json.insert("block_size", COINBASE_BINARY_SIZE);
+  json.insert("transactions_cumulative_size", COINBASE_BINARY_SIZE);
+  json.insert("already_generated_coins", BLOCK_REWARD * (_height / 1000));
+  json.insert("already_generated_transactions", _height);
+  json.insert("size_median", COINBASE_BINARY_SIZE);
+  json.insert("effective_size_median", 100000);
+  json.insert("timestamp_median", makeTimestamp(_height - 30).toTime_t());
+  json.insert("total_fee_amount", 0);
+  return json;
+}
+
+// get_transfers result with one mined block per transaction, newest first.
+QVariantMap makeTransfersJson(int _transactionCount) {
+  QVariantList blocks;
+  for (int i = 0; i < _transactionCount; ++i) {
+    const RpcApi::Height height = HISTORY_TOP_HEIGHT - i;
+    QVariantMap block;
+    block.insert("header", makeBlockHeaderJson(height));
+    block.insert("transactions", QVariantList() << makeTransaction(height, 1, 1).toJson());
+    blocks.append(block);
+  }
+
+  QVariantMap json;
+  json.insert("blocks", blocks);
+  json.insert("unlocked_transfers", QVariantList());
+  json.insert("next_from_height", HISTORY_TOP_HEIGHT - _transactionCount + 1);
+  json.insert("next_to_height", HISTORY_TOP_HEIGHT - _transactionCount);
+  return json;
+}
+
+QJsonObject makeTransfersReply(int _transactionCount) {
+  QJsonObject reply;
+  reply.insert("jsonrpc", "2.0");
+  reply.insert("id", "0");
+  reply.insert("result", QJsonObject::fromVariantMap(makeTransfersJson(_transactionCount)));
+  return reply;
+}
+
+// Confirmed history page below _topHeight, as RemoteWalletd hands it to WalletModel.
+RpcApi::Transfers makeHistoryPage(RpcApi::Height _topHeight, int _transactionCount) {
+  RpcApi::Transfers page;
+  for (int i = 0; i < _transactionCount; ++i) {
+    RpcApi::Block block;
+    block.header.height = _topHeight - i;
+    block.transactions.append(makeTransaction(_topHeight - i, 1, 1));
+    page.blocks.append(block);
+  }
+
+  page.next_from_height = _topHeight - _transactionCount + 1;
+  page.next_to_height = _topHeight - _transactionCount;
+  return page;
+}
+
+void moveHistoryPage(RpcApi::Transfers& _page, RpcApi::Height _distance) {
+  for (RpcApi::Block& block : _page.blocks) {
+    block.header.height -= _distance;
+    for (RpcApi::Transaction& transaction : block.transactions) {
+      transaction.block_height -= _distance;
+    }
+  }
+
+  _page.next_from_height -= _distance;
+  _page.next_to_height -= _distance;
+}
+
+RpcApi::Status makeStatus() {
+  RpcApi::Status status;
+  status.top_block_hash = makeHash(~static_cast<quint64>(TOP_BLOCK_HEIGHT));
+  status.outgoing_peer_count = 8;
+  status.lower_level_error.clear();
+  status.top_block_height = TOP_BLOCK_HEIGHT;
+  status.top_known_block_height = TOP_BLOCK_HEIGHT;
+  status.top_block_difficulty = 1000000;
+  status.top_block_timestamp = makeTimestamp(TOP_BLOCK_HEIGHT);
+  return status;
+}
+
+void addHistorySizeRows() {
+  QTest::addColumn<int>("transactionCount");
+  QTest::newRow("10k") << 10000;
+  QTest::newRow("100k") << 100000;
+  QTest::newRow("1M") << 1000000;
+}
+
+void addReplySizeRows() {
+  QTest::addColumn<int>("transactionCount");
+  QTest::newRow("page") << HISTORY_PAGE_SIZE;
+  QTest::newRow("1000") << 1000;
+}
+
+}
+
+WalletBenchmark::WalletBenchmark(QObject* _parent) : QObject(_parent) {
+}
+
+WalletBenchmark::~WalletBenchmark() {
+}
+
+void WalletBenchmark::transactionFromJson_data() {
+  QTest::addColumn<int>("transferCount");
+  QTest::addColumn<int>("outputsPerTransfer");
+  QTest::newRow("1 transfer") << 1 << 1;
+  QTest::newRow("4 transfers") << 4 << 2;
+  QTest::newRow("16 transfers") << 16 << 4;
+}
+
+void WalletBenchmark::transactionFromJson() {
+  QFETCH(int, transferCount);
+  QFETCH(int, outputsPerTransfer);
+  const QVariantMap json = makeTransaction(HISTORY_TOP_HEIGHT, transferCount, outputsPerTransfer).toJson();
+  RpcApi::Transaction transaction;
+  QBENCHMARK {
+    transaction = RpcApi::Transaction::fromJson(json);
+  }
+
+  QCOMPARE(transaction.transfers.size(), transferCount);
+}
+
+void WalletBenchmark::transfersFromJson_data() {
+  addReplySizeRows();
+}
+
+void WalletBenchmark::transfersFromJson() {
+  QFETCH(int, transactionCount);
+  const QVariantMap json = makeTransfersJson(transactionCount);
+  RpcApi::Transfers transfers;
+  QBENCHMARK {
+    transfers = RpcApi::Transfers::fromJson(json);
+  }
+
+  QCOMPARE(transfers.blocks.size(), transactionCount);
+}
+
+void WalletBenchmark::parseReply_data() {
+  addReplySizeRows();
+}
+
+// The QJsonDocument step JsonRpc::Client runs on every reply before the factory sees it.
+void WalletBenchmark::parseReply() {
+  QFETCH(int, transactionCount);
+  const QByteArray data = QJsonDocument(makeTransfersReply(transactionCount)).toJson(QJsonDocument::Compact);
+  QJsonDocument document;
+  QBENCHMARK {
+    document = QJsonDocument::fromJson(data);
+  }
+
+  QVERIFY(document.isObject());
+}
+
+void WalletBenchmark::createJsonRpcObject_data() {
+  addReplySizeRows();
+}
+
+void WalletBenchmark::createJsonRpcObject() {
+  QFETCH(int, transactionCount);
+  const QJsonValue reply(makeTransfersReply(transactionCount));
+  int errorCode = 0;
+  QString errorString;
+  QString errorData;
+  bool isCreated = true;
+  QBENCHMARK {
+    QScopedPointer<JsonRpc::JsonRpcObject> object(JsonRpc::JsonRpcObjectFactory::createJsonRpcObject(reply, errorCode,
+      errorString, errorData));
+    isCreated = isCreated && !object.isNull();
+  }
+
+  QVERIFY(isCreated);
+}
+
+void WalletBenchmark::loadHistory_data() {
+  addHistorySizeRows();
+}
+
+// The whole history arrives in one reply. Creating and destroying the model is part of the
+// measurement, since every run needs an empty one.
+void WalletBenchmark::loadHistory() {
+  QFETCH(int, transactionCount);
+  const RpcApi::Status status = makeStatus();
+  const RpcApi::Transfers history = makeHistoryPage(HISTORY_TOP_HEIGHT, transactionCount);
+  int rowCount = 0;
+  QBENCHMARK {
+    WalletModel model(nullptr);
+    model.statusReceived(status);
+    model.transfersReceived(history);
+    rowCount = model.rowCount();
+  }
+
+  QVERIFY(rowCount >= transactionCount);
+}
+
+void WalletBenchmark::appendHistoryPage_data() {
+  addHistorySizeRows();
+}
+
+// One more page of older transactions, as fetchMore() brings it in while the history view scrolls.
+// Every run first moves the page below the current bottom, which touches only its
+// HISTORY_PAGE_SIZE transactions.
+void WalletBenchmark::appendHistoryPage() {
+  QFETCH(int, transactionCount);
+  WalletModel model(nullptr);
+  model.statusReceived(makeStatus());
+  model.transfersReceived(makeHistoryPage(HISTORY_TOP_HEIGHT, transactionCount));
+  QVERIFY(model.rowCount() >= transactionCount);
+
+  RpcApi::Transfers page = makeHistoryPage(HISTORY_TOP_HEIGHT - transactionCount + HISTORY_PAGE_SIZE, HISTORY_PAGE_SIZE);
+  int appendedCount = 0;
+  QBENCHMARK {
+    moveHistoryPage(page, HISTORY_PAGE_SIZE);
+    model.transfersReceived(page);
+    appendedCount += HISTORY_PAGE_SIZE;
+  }
+
+  QVERIFY(model.rowCount() >= transactionCount + appendedCount);
+}
+
+void WalletBenchmark::formatUnsignedAmount_data() {
+  QTest::addColumn<quint64>("amount");
+  QTest::addColumn<bool>("trim");
+  QTest::newRow("zero") << Q_UINT64_C(0) << true;
+  QTest::newRow("dust") << Q_UINT64_C(1) << true;
+  QTest::newRow("reward") << BLOCK_REWARD << true;
+  QTest::newRow("round") << Q_UINT64_C(1000000000000000) << true;
+  QTest::newRow("round untrimmed") << Q_UINT64_C(1000000000000000) << false;
+  QTest::newRow("max") << std::numeric_limits<quint64>::max() << true;
+}
+
+void WalletBenchmark::formatUnsignedAmount() {
+  QFETCH(quint64, amount);
+  QFETCH(bool, trim);
+  QString text;
+  QBENCHMARK {
+    text = WalletGUI::formatUnsignedAmount(amount, trim);
+  }
+
+  QVERIFY(!text.isEmpty());
+}
+
+void WalletBenchmark::formatHashRate_data() {
+  QTest::addColumn<quint64>("hashRate");
+  QTest::newRow("H/s") << Q_UINT64_C(850);
+  QTest::newRow("KH/s") << Q_UINT64_C(12500);
+  QTest::newRow("MH/s") << Q_UINT64_C(3400000);
+  QTest::newRow("GH/s") << Q_UINT64_C(7800000001);
+  QTest::newRow("TH/s") << Q_UINT64_C(2100000000000);
+}
+
+void WalletBenchmark::formatHashRate() {
+  QFETCH(quint64, hashRate);
+  QString text;
+  QBENCHMARK {
+    text = WalletGUI::formatHashRate(hashRate);
+  }
+
+  QVERIFY(!text.isEmpty());
+}
+
+void WalletBenchmark::addressBookLookup_data() {
+  QTest::addColumn<int>("bookSize");
+  QTest::addColumn<QString>("lookup");
+  for (int bookSize : {1000, 10000}) {
+    for (const char* lookup : {"address", "label", "both"}) {
+      QTest::newRow(qPrintable(QString("%1 %2").arg(bookSize).arg(lookup))) << bookSize << QString(lookup);
+    }
+  }
+}
+
+// Looks up the newest entry, the worst case of the linear findAddress(). The book lives in the work
+// directory main() redirects, and grows across rows instead of being rebuilt.
+void WalletBenchmark::addressBookLookup() {
+  QFETCH(int, bookSize);
+  QFETCH(QString, lookup);
+  AddressBookManager addressBook(nullptr);
+  for (int i = addressBook.getAddressCount(); i < bookSize; ++i) {
+    addressBook.addAddress(QString("Miner %1").arg(i), makeAddress(i));
+  }
+
+  QVERIFY(addressBook.getAddressCount() >= bookSize);
+  const QString label = QString("Miner %1").arg(bookSize - 1);
+  const QString address = makeAddress(bookSize - 1);
+  AddressIndex index = INVALID_ADDRESS_INDEX;
+  if (lookup == "address") {
+    QBENCHMARK {
+      index = addressBook.findAddressByAddress(address);
+    }
+  } else if (lookup == "label") {
+    QBENCHMARK {
+      index = addressBook.findAddressByLabel(label);
+    }
+  } else {
+    QBENCHMARK {
+      index = addressBook.findAddress(label, address);
+    }
+  }
+
+  QCOMPARE(index, bookSize - 1);
+}
+
+}
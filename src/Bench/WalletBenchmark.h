@@ -0,0 +1,43 @@
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#pragma once
+
+#include <QObject>
+
+namespace WalletGUI {
+
+// QtTest micro-benchmarks of the wallet data path: decoding walletd replies, loading the history into
+// WalletModel, formatting amounts and looking up the address book. All payloads are synthetic and
+// shaped like a mining wallet's history, one coinbase transaction per block. Run with -help for the
+// QtTest options, e.g. -iterations, -median or -csv.
+class WalletBenchmark : public QObject {
+  Q_OBJECT
+  Q_DISABLE_COPY(WalletBenchmark)
+
+public:
+  WalletBenchmark(QObject* _parent);
+  ~WalletBenchmark();
+
+private Q_SLOTS:
+  void transactionFromJson_data();
+  void transactionFromJson();
+  void transfersFromJson_data();
+  void transfersFromJson();
+  void parseReply_data();
+  void parseReply();
+  void createJsonRpcObject_data();
+  void createJsonRpcObject();
+  void loadHistory_data();
+  void loadHistory();
+  void appendHistoryPage_data();
+  void appendHistoryPage();
+  void formatUnsignedAmount_data();
+  void formatUnsignedAmount();
+  void formatHashRate_data();
+  void formatHashRate();
+  void addressBookLookup_data();
+  void addressBookLookup();
+};
+
+}
@@ -0,0 +1,76 @@
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QDir>
+#include <QJsonDocument>
+#include <QThread>
+
+#include <cstdio>
+
+#include "MinerBenchmark.h"
+#include "logger.h"
+
+using namespace WalletGUI;
+
+namespace {
+
+bool parseUInt(const QCommandLineParser& _parser, const QCommandLineOption& _option, quint32 _min, quint32 _max, quint32& _value) {
+  bool ok = false;
+  _value = _parser.value(_option).toUInt(&ok);
+  if (!ok || _value < _min || _value > _max) {
+    fprintf(stderr, "Invalid value for --%s: %s\n", qPrintable(_option.names().first()), qPrintable(_parser.value(_option)));
+    return false;
+  }
+
+  return true;
+}
+
+}
+
+int main(int argc, char* argv[]) {
+  QCoreApplication app(argc, argv);
+  app.setApplicationName("gdoge-bench-miner");
+
+  const int idealThreadCount = qMax(QThread::idealThreadCount(), 1);
+  QCommandLineParser parser;
+  parser.setApplicationDescription("Offline CryptoNight mining benchmark. Prints the results as JSON.");
+  parser.addHelpOption();
+  QCommandLineOption threadsOption("threads", "Number of mining threads.", "count", QString::number(idealThreadCount));
+  QCommandLineOption durationOption("duration", "Benchmark duration in seconds.", "seconds", "30");
+  QCommandLineOption batchOption("nonce-batch", "Nonces reserved by a thread at once.", "count", "256");
+  QCommandLineOption jobIntervalOption("job-interval", "Publish a new job every N milliseconds, 0 to disable.", "msecs", "1000");
+  QCommandLineOption noPinOption("no-pin", "Do not pin mining threads to CPUs.");
+  parser.addOption(threadsOption);
+  parser.addOption(durationOption);
+  parser.addOption(batchOption);
+  parser.addOption(jobIntervalOption);
+  parser.addOption(noPinOption);
+  parser.process(app);
+
+  MinerBenchmarkOptions options;
+  quint32 durationSeconds = 0;
+  if (!parseUInt(parser, threadsOption, 1, 1024, options.threadCount) ||
+    !parseUInt(parser, durationOption, 1, 24 * 60 * 60, durationSeconds) ||
+    !parseUInt(parser, batchOption, 1, 1 << 20, options.nonceBatchSize) ||
+    !parseUInt(parser, jobIntervalOption, 0, 24 * 60 * 60 * 1000, options.jobSwitchIntervalMsecs)) {
+    return 1;
+  }
+
+  options.durationMsecs = durationSeconds * 1000;
+  options.pinThreads = !parser.isSet(noPinOption);
+
+  WalletLogger::init(QDir::temp(), false, &app);
+  int result = 0;
+  {
+    MinerBenchmark benchmark(options, nullptr);
+    QObject::connect(&benchmark, &MinerBenchmark::finishedSignal, &app, &QCoreApplication::quit, Qt::QueuedConnection);
+    benchmark.start();
+    result = app.exec();
+    fprintf(stdout, "%s", QJsonDocument(benchmark.getResult()).toJson(QJsonDocument::Indented).constData());
+  }
+
+  WalletLogger::deinit();
+  return result;
+}
@@ -0,0 +1,53 @@
+#-------------------------------------------------
+#
+# Offline mining benchmark
+#
+#-------------------------------------------------
+
+QT       += core
+QT       -= gui
+
+TARGET = gdoge-bench-miner
+TEMPLATE = app
+
+!win32: QMAKE_CXXFLAGS += -std=c++14 -Wall -Wextra
+
+CONFIG += c++14 strict_c++ console
+CONFIG -= app_bundle
+
+DESTDIR = $$PWD/../../bin
+
+INCLUDEPATH += $$PWD/..
+
+SOURCES += \
+    gdoge-bench-miner.cpp \
+    MinerBenchmark.cpp \
+    ../Miner/CpuTopology.cpp \
+    ../Miner/CryptoNightKernel.cpp \
+    ../Miner/JobSlot.cpp \
+    ../Miner/ShareQueue.cpp \
+    ../Miner/Worker.cpp \
+    ../Trace/TraceRecorder.cpp \
+    ../logger.cpp
+
+HEADERS += \
+    MinerBenchmark.h \
+    ../IMinerWorker.h \
+    ../Miner/CpuTopology.h \
+    ../Miner/CryptoNightKernel.h \
+    ../Miner/HashCounter.h \
+    ../Miner/NoncePartition.h \
+    ../Miner/WorkSplitter.h \
+    ../Miner/JobSlot.h \
+    ../Miner/ShareQueue.h \
+    ../Miner/Worker.h \
+    ../Trace/TraceRecorder.h \
+    ../logger.h
+
+unix|win32: LIBS += -L$$PWD/../../../GoldenDoge/libs/ -lzelerius-crypto
+
+INCLUDEPATH += $$PWD/../../../GoldenDoge/src
+DEPENDPATH += $$PWD/../../../GoldenDoge/src
+
+win32:!win32-g++: PRE_TARGETDEPS += $$PWD/../../../GoldenDoge/libs/zelerius-crypto.lib
+else:unix|win32-g++: PRE_TARGETDEPS += $$PWD/../../../GoldenDoge/libs/libzelerius-crypto.a
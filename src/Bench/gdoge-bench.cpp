@@ -0,0 +1,41 @@
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#include <QCoreApplication>
+#include <QDir>
+#include <QFile>
+#include <QStandardPaths>
+#include <QTemporaryDir>
+#include <QTest>
+
+#include <cstdio>
+
+#include "WalletBenchmark.h"
+#include "logger.h"
+
+using namespace WalletGUI;
+
+int main(int argc, char* argv[]) {
+  QCoreApplication app(argc, argv);
+  app.setApplicationName("gdoge-bench");
+
+  // Settings and the address book are opened in the work directory under the home directory, so the
+  // benchmark gets a home of its own and never touches the user's files.
+  QTemporaryDir homeDir;
+  if (!homeDir.isValid()) {
+    fprintf(stderr, "Can't create a temporary directory\n");
+    return 1;
+  }
+
+  qputenv("HOME", QFile::encodeName(homeDir.path()));
+  QStandardPaths::setTestModeEnabled(true);
+  WalletLogger::init(QDir(homeDir.path()), false, &app);
+  int result = 0;
+  {
+    WalletBenchmark benchmark(nullptr);
+    result = QTest::qExec(&benchmark, argc, argv);
+  }
+
+  WalletLogger::deinit();
+  return result;
+}
@@ -0,0 +1,61 @@
+#-------------------------------------------------
+#
+# Wallet data path micro-benchmarks
+#
+#-------------------------------------------------
+
+QT       += core gui widgets network testlib
+
+TARGET = gdoge-bench
+TEMPLATE = app
+
+!win32: QMAKE_CXXFLAGS += -std=c++14 -Wall -Wextra
+
+CONFIG += c++14 strict_c++ console
+CONFIG -= app_bundle
+
+DESTDIR = $$PWD/../../bin
+
+INCLUDEPATH += $$PWD/..
+
+SOURCES += \
+    gdoge-bench.cpp \
+    WalletBenchmark.cpp \
+    ../JsonRpc/JsonRpcClient.cpp \
+    ../JsonRpc/JsonRpcNotification.cpp \
+    ../JsonRpc/JsonRpcObject.cpp \
+    ../JsonRpc/JsonRpcObjectFactory.cpp \
+    ../JsonRpc/JsonRpcRequest.cpp \
+    ../JsonRpc/JsonRpcResponse.cpp \
+    ../Metrics/LatencyHistogram.cpp \
+    ../Trace/TraceRecorder.cpp \
+    ../addressbookmanager.cpp \
+    ../common.cpp \
+    ../exportkeydialog.cpp \
+    ../logger.cpp \
+    ../rpcapi.cpp \
+    ../settings.cpp \
+    ../walletd.cpp \
+    ../walletmodel.cpp
+
+HEADERS += \
+    WalletBenchmark.h \
+    ../JsonRpc/JsonRpcClient.h \
+    ../JsonRpc/JsonRpcNotification.h \
+    ../JsonRpc/JsonRpcObject.h \
+    ../JsonRpc/JsonRpcObjectFactory.h \
+    ../JsonRpc/JsonRpcRequest.h \
+    ../JsonRpc/JsonRpcResponse.h \
+    ../Metrics/LatencyHistogram.h \
+    ../Trace/TraceRecorder.h \
+    ../addressbookmanager.h \
+    ../common.h \
+    ../exportkeydialog.h \
+    ../logger.h \
+    ../rpcapi.h \
+    ../settings.h \
+    ../walletd.h \
+    ../walletmodel.h
+
+FORMS += \
+    ../exportkeydialog.ui
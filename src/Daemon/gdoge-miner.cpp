@@ -0,0 +1,214 @@
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QDir>
+#include <QTimer>
+
+#include <cstdio>
+#include <functional>
+
+#include "IPoolMiner.h"
+#include "Metrics/MetricsServer.h"
+#include "MiningManager.h"
+#include "Trace/TraceRecorder.h"
+#include "common.h"
+#include "logger.h"
+#include "settings.h"
+#include "signalhandler.h"
+
+using namespace WalletGUI;
+
+namespace {
+
+const int STATUS_INTERVAL = 60000;
+
+void makeDir(const QDir& _dir) {
+  if (!_dir.exists()) {
+    _dir.mkpath(_dir.absolutePath());
+  }
+}
+
+// The mining options below are saved like a change made in the GUI, so that later runs keep them.
+bool applyUInt(const QCommandLineParser& _parser, const QCommandLineOption& _option, quint32 _min, quint32 _max,
+  const std::function<void(quint32)>& _apply) {
+  if (!_parser.isSet(_option)) {
+    return true;
+  }
+
+  bool ok = false;
+  const quint32 value = _parser.value(_option).toUInt(&ok);
+  if (!ok || value < _min || value > _max) {
+    fprintf(stderr, "Invalid value for --%s: %s\n", qPrintable(_option.names().first()), qPrintable(_parser.value(_option)));
+    return false;
+  }
+
+  _apply(value);
+  return true;
+}
+
+bool applySwitch(const QCommandLineParser& _parser, const QCommandLineOption& _option, const std::function<void(bool)>& _apply) {
+  if (!_parser.isSet(_option)) {
+    return true;
+  }
+
+  const QString value = _parser.value(_option);
+  if (value != "on" && value != "off") {
+    fprintf(stderr, "Invalid value for --%s: %s, expected on or off\n", qPrintable(_option.names().first()), qPrintable(value));
+    return false;
+  }
+
+  _apply(value == "on");
+  return true;
+}
+
+// An empty list clears the exclusions.
+bool applyCpuList(const QCommandLineParser& _parser, const QCommandLineOption& _option,
+  const std::function<void(const QList<int>&)>& _apply) {
+  if (!_parser.isSet(_option)) {
+    return true;
+  }
+
+  QList<int> cpus;
+  for (const QString& cpu : _parser.value(_option).split(',', QString::SkipEmptyParts)) {
+    bool ok = false;
+    const int value = cpu.trimmed().toInt(&ok);
+    if (!ok || value < 0) {
+      fprintf(stderr, "Invalid value for --%s: %s\n", qPrintable(_option.names().first()), qPrintable(_parser.value(_option)));
+      return false;
+    }
+
+    cpus.append(value);
+  }
+
+  _apply(cpus);
+  return true;
+}
+
+void logStatus(const MiningManager& _miningManager) {
+  for (quintptr i = 0; i < _miningManager.getMinerCount(); ++i) {
+    const IPoolMiner* miner = _miningManager.getMiner(i);
+    if (miner->getCurrentState() == IPoolMiner::STATE_STOPPED) {
+      continue;
+    }
+
+    WalletLogger::info(QString("[Miner] %1:%2: %3, difficulty %4, shares %5 good / %6 bad / %7 stale").
+      arg(miner->getPoolHost()).arg(miner->getPoolPort()).
+      arg(formatHashRate(qRound64(miner->getAverageHashRate(HashRateWindow::SECONDS_60)))).arg(miner->getDifficulty()).
+      arg(miner->getGoodShareCount()).arg(miner->getBadShareCount()).arg(miner->getStaleShareCount()));
+  }
+}
+
+}
+
+// Mines on the pools and with the mining options of the GUI settings, without a window and without
+// a wallet: the main account login is given on the command line.
+int main(int argc, char* argv[]) {
+  QCoreApplication app(argc, argv);
+  // The GUI's name, so that the settings and logs are found in the GUI's data directory under Mac and Win.
+  app.setApplicationName(APPLICATION_NAME);
+
+  QCommandLineParser parser;
+  parser.setApplicationDescription("Headless GoldenDoge miner. Uses the pool list and mining options of the GUI settings.");
+  parser.addHelpOption();
+  QCommandLineOption loginOption("login", "Wallet address to mine for.", "address");
+  QCommandLineOption debugOption("debug", "Write debug messages to the log.");
+  QCommandLineOption traceOption("trace", "Record a trace of the hot paths. It is written to the log directory on SIGUSR1 and on exit.");
+  QCommandLineOption metricsPortOption("metrics-port", "Serve Prometheus metrics on 127.0.0.1:<port>/metrics, 0 turns it off.", "port");
+  QCommandLineOption dutyCycleOption("duty-cycle", "Percentage of the time the mining threads hash, 1 to 100.", "percent");
+  QCommandLineOption idleOption("idle", "Run the mining threads at idle priority where supported.", "on|off");
+  QCommandLineOption niceOption("nice", "Nice level of the mining threads, 0 to 19.", "level");
+  QCommandLineOption nonceInstanceOption("nonce-instance", "Id of this miner among those sharing a login, below 2^bits.", "id");
+  QCommandLineOption noncePartitionBitsOption("nonce-partition-bits",
+    "Top nonce bits reserved for the instance id, 0 to 8. Must be the same on every miner sharing a login.", "bits");
+  QCommandLineOption autoDifficultyOption("auto-difficulty", "Request a login difficulty from the measured hash rate.", "on|off");
+  QCommandLineOption sharesPerMinuteOption("shares-per-minute", "Share rate the automatic difficulty aims for, 1 to 60.", "shares");
+  QCommandLineOption difficultyDriftOption("difficulty-drift",
+    "Hash rate change in percent, 5 to 100, that makes the automatic difficulty log in again.", "percent");
+  QCommandLineOption pinThreadsOption("pin-threads", "Pin each mining thread to its own CPU.", "on|off");
+  QCommandLineOption excludeCpusOption("exclude-cpus", "Comma separated CPUs the mining threads are never pinned to.", "cpus");
+  QCommandLineOption nonceBatchSizeOption("nonce-batch-size", "Nonces a mining thread reserves at once, 64 to 4096.", "nonces");
+  QCommandLineOption hotStandbyOption("hot-standby", "Keep the next pool in the failover order logged in.", "on|off");
+  parser.addOption(loginOption);
+  parser.addOption(debugOption);
+  parser.addOption(metricsPortOption);
+  parser.addOption(traceOption);
+  parser.addOption(dutyCycleOption);
+  parser.addOption(idleOption);
+  parser.addOption(niceOption);
+  parser.addOption(hotStandbyOption);
+  parser.addOption(nonceInstanceOption);
+  parser.addOption(noncePartitionBitsOption);
+  parser.addOption(autoDifficultyOption);
+  parser.addOption(sharesPerMinuteOption);
+  parser.addOption(difficultyDriftOption);
+  parser.addOption(pinThreadsOption);
+  parser.addOption(excludeCpusOption);
+  parser.addOption(nonceBatchSizeOption);
+  parser.process(app);
+
+  const QString login = parser.value(loginOption).trimmed();
+  if (login.isEmpty()) {
+    fprintf(stderr, "Missing --login\n");
+    return 1;
+  }
+
+  const QDir dataDir = Settings::instance().getDefaultWorkDir();
+  const QDir logsDir = dataDir.absoluteFilePath("logs/gdoge-miner");
+  makeDir(logsDir);
+  WalletLogger::init(logsDir, parser.isSet(debugOption), &app);
+  QObject::connect(&SignalHandler::instance(), &SignalHandler::quitSignal, &app, &QCoreApplication::quit);
+  const bool isTraceEnabled = parser.isSet(traceOption) || Settings::instance().isTraceEnabled();
+  TraceRecorder::setEnabled(isTraceEnabled);
+  QObject::connect(&SignalHandler::instance(), &SignalHandler::dumpTraceSignal, &app,
+    [logsDir]() { TraceRecorder::dump(TraceRecorder::makeFileName(logsDir)); }, Qt::QueuedConnection);
+
+  int result = 0;
+  {
+    MiningManager miningManager(nullptr);
+    miningManager.setLogin(login);
+    miningManager.loadMiners();
+    Settings& settings = Settings::instance();
+    if (!applyUInt(parser, dutyCycleOption, 1, 100, [&miningManager](quint32 _value) { miningManager.setDutyCycle(_value); }) ||
+      !applySwitch(parser, idleOption, [&settings](bool _value) { settings.setMiningIdlePriorityEnabled(_value); }) ||
+      !applyUInt(parser, niceOption, 0, 19, [&settings](quint32 _value) { settings.setMiningNiceLevel(_value); }) ||
+      !applySwitch(parser, hotStandbyOption, [&settings](bool _value) { settings.setMiningHotStandbyEnabled(_value); }) ||
+      !applyUInt(parser, noncePartitionBitsOption, 0, 8, [&settings](quint32 _value) { settings.setMiningNoncePartitionBits(_value); }) ||
+      !applyUInt(parser, nonceInstanceOption, 0, 255, [&settings](quint32 _value) { settings.setMiningNonceInstanceId(_value); }) ||
+      !applySwitch(parser, autoDifficultyOption, [&settings](bool _value) { settings.setMiningAutoDifficultyEnabled(_value); }) ||
+      !applyUInt(parser, sharesPerMinuteOption, 1, 60, [&settings](quint32 _value) { settings.setMiningSharesPerMinute(_value); }) ||
+      !applyUInt(parser, difficultyDriftOption, 5, 100,
+        [&settings](quint32 _value) { settings.setMiningDifficultyDriftThreshold(_value); }) ||
+      !applySwitch(parser, pinThreadsOption, [&settings](bool _value) { settings.setMiningThreadPinningEnabled(_value); }) ||
+      !applyCpuList(parser, excludeCpusOption, [&settings](const QList<int>& _cpus) { settings.setMiningExcludedCpus(_cpus); }) ||
+      !applyUInt(parser, nonceBatchSizeOption, 64, 4096, [&settings](quint32 _value) { settings.setMiningNonceBatchSize(_value); }) ||
+      !applyUInt(parser, metricsPortOption, 0, 65535, [&settings](quint32 _value) { settings.setMetricsPort(_value); })) {
+      result = 1;
+    } else if (miningManager.getMinerCount() == 0) {
+      fprintf(stderr, "No mining pools configured in %s\n", qPrintable(dataDir.absolutePath()));
+      result = 1;
+    } else {
+      WalletLogger::info(QString("[Miner] Mining for %1 on %2 threads").arg(login).arg(miningManager.getCpuCoreCount()));
+      QTimer statusTimer;
+      QObject::connect(&statusTimer, &QTimer::timeout, [&miningManager]() { logStatus(miningManager); });
+      statusTimer.start(STATUS_INTERVAL);
+      const quint16 metricsPort = settings.getMetricsPort();
+      MetricsServer metricsServer(nullptr);
+      metricsServer.addSource(&miningManager);
+      if (metricsPort != 0) {
+        metricsServer.start(metricsPort);
+      }
+
+      miningManager.startMining();
+      result = app.exec();
+    }
+  }
+
+  if (isTraceEnabled) {
+    TraceRecorder::dump(TraceRecorder::makeFileName(logsDir));
+  }
+
+  WalletLogger::deinit();
+  return result;
+}
@@ -0,0 +1,87 @@
+#-------------------------------------------------
+#
+# Headless miner
+#
+#-------------------------------------------------
+
+QT       += core network
+QT       -= gui
+
+TARGET = gdoge-miner
+TEMPLATE = app
+
+!win32: QMAKE_CXXFLAGS += -std=c++14 -Wall -Wextra
+
+CONFIG += c++14 strict_c++ console
+CONFIG -= app_bundle
+
+DESTDIR = $$PWD/../../bin
+
+INCLUDEPATH += $$PWD/..
+
+SOURCES += \
+    gdoge-miner.cpp \
+    ../Miner/CpuTopology.cpp \
+    ../Miner/CryptoNightKernel.cpp \
+    ../Miner/HashAlgorithm.cpp \
+    ../Miner/HashRateStatistics.cpp \
+    ../Miner/JobSlot.cpp \
+    ../Miner/LineFramer.cpp \
+    ../Miner/Miner.cpp \
+    ../Miner/RecentJobRing.cpp \
+    ../Miner/ShareQueue.cpp \
+    ../Miner/StratumClient.cpp \
+    ../Miner/StratumJobParser.cpp \
+    ../Miner/TimerWheel.cpp \
+    ../Miner/Worker.cpp \
+    ../Miner/WorkerPool.cpp \
+    ../Metrics/LatencyHistogram.cpp \
+    ../Metrics/MetricsServer.cpp \
+    ../Metrics/MetricsWriter.cpp \
+    ../MiningManager.cpp \
+    ../Trace/TraceRecorder.cpp \
+    ../common.cpp \
+    ../logger.cpp \
+    ../settings.cpp \
+    ../signalhandler.cpp
+
+HEADERS += \
+    ../IMetricsSource.h \
+    ../IMinerWorker.h \
+    ../IMiningManager.h \
+    ../IPoolClient.h \
+    ../IPoolMiner.h \
+    ../Miner/CpuTopology.h \
+    ../Miner/CryptoNightKernel.h \
+    ../Miner/HashAlgorithm.h \
+    ../Miner/HashCounter.h \
+    ../Miner/HashRateStatistics.h \
+    ../Miner/JobSlot.h \
+    ../Miner/LineFramer.h \
+    ../Miner/Miner.h \
+    ../Miner/NoncePartition.h \
+    ../Miner/RecentJobRing.h \
+    ../Miner/ShareQueue.h \
+    ../Miner/StratumClient.h \
+    ../Miner/StratumJobParser.h \
+    ../Miner/TimerWheel.h \
+    ../Miner/WorkSplitter.h \
+    ../Miner/Worker.h \
+    ../Miner/WorkerPool.h \
+    ../Metrics/LatencyHistogram.h \
+    ../Metrics/MetricsServer.h \
+    ../Metrics/MetricsWriter.h \
+    ../MiningManager.h \
+    ../Trace/TraceRecorder.h \
+    ../common.h \
+    ../logger.h \
+    ../settings.h \
+    ../signalhandler.h
+
+unix|win32: LIBS += -L$$PWD/../../../GoldenDoge/libs/ -lzelerius-crypto
+
+INCLUDEPATH += $$PWD/../../../GoldenDoge/src
+DEPENDPATH += $$PWD/../../../GoldenDoge/src
+
+win32:!win32-g++: PRE_TARGETDEPS += $$PWD/../../../GoldenDoge/libs/zelerius-crypto.lib
+else:unix|win32-g++: PRE_TARGETDEPS += $$PWD/../../../GoldenDoge/libs/libzelerius-crypto.a
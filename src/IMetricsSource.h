@@ -0,0 +1,17 @@
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#pragma once
+
+namespace WalletGUI {
+
+class MetricsWriter;
+
+// Something that contributes samples to a /metrics scrape. Called on the thread of the metrics server.
+class IMetricsSource {
+public:
+  virtual ~IMetricsSource() {}
+  virtual void writeMetrics(MetricsWriter& _writer) const = 0;
+};
+
+}
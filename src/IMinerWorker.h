@@ -1,34 +1,45 @@
-// Copyright (c) 2015-2018, The Bytecoin developers.
-// Licensed under the GNU Lesser General Public License. See LICENSE for details.
-
-#pragma once
-
-#include <QObject>
-
-namespace WalletGUI {
-
-struct Job {
-  QString jobId;
-  quint32 target;
-  QByteArray blob;
-};
-
-class IMinerWorkerObserver {
-public:
-  virtual ~IMinerWorkerObserver() {}
-  virtual void shareFound(const QString& _jobId, quint32 _nonce, const QByteArray& _result) = 0;
-};
-
-class IMinerWorker {
-public:
-  virtual ~IMinerWorker() {}
-
-  virtual void start() = 0;
-  virtual void stop() = 0;
-  virtual void addObserver(IMinerWorkerObserver* _observer) = 0;
-  virtual void removeObserver(IMinerWorkerObserver* _observer) = 0;
-  virtual void addAlternateObserver(IMinerWorkerObserver* _observer) = 0;
-  virtual void removeAlternateObserver(IMinerWorkerObserver* _observer) = 0;
-};
-
-}
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#pragma once
+
+#include <QObject>
+
+#include <atomic>
+#include <memory>
+
+namespace WalletGUI {
+
+enum class HashAlgorithm : int {
+  UNKNOWN, CRYPTONIGHT, CRYPTONIGHT_V1
+};
+
+struct Job {
+  QString jobId;
+  quint32 target;
+  QByteArray blob;
+  quint64 generation;
+  HashAlgorithm algorithm;
+  // Nonce counter of this job, created when the job is published and shared by every copy of it.
+  std::shared_ptr<std::atomic<quint32>> nonce;
+};
+
+// Scheduling of a mining thread relative to the rest of the system.
+struct WorkerPriority {
+  bool idle;
+  int niceLevel;
+};
+
+class IMinerWorker {
+public:
+  virtual ~IMinerWorker() {}
+
+  virtual void start() = 0;
+  virtual void stop() = 0;
+  virtual void setCpu(int _cpu) = 0;
+  virtual void setPriority(const WorkerPriority& _priority) = 0;
+  virtual quint64 getHashCount() const = 0;
+  virtual quint64 getAlternateHashCount() const = 0;
+};
+
+}
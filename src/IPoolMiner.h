@@ -1,55 +1,97 @@
-// Copyright (c) 2015-2018, The Bytecoin developers.
-// Licensed under the GNU Lesser General Public License. See LICENSE for details.
-
-#pragma once
-
-#include <QObject>
-
-namespace WalletGUI {
-
-class IPoolMinerObserver {
-public:
-  virtual ~IPoolMinerObserver() {}
-  virtual void stateChanged(int _newState) = 0;
-  virtual void hashRateChanged(quint32 _hashRate) = 0;
-  virtual void alternateHashRateChanged(quint32 _hashRate) = 0;
-  virtual void difficultyChanged(quint32 _difficulty) = 0;
-  virtual void goodShareCountChanged(quint32 _goodShareCount) = 0;
-  virtual void goodAlternateShareCountChanged(quint32 _goodShareCount) = 0;
-  virtual void badShareCountChanged(quint32 _badShareCount) = 0;
-  virtual void connectionErrorCountChanged(quint32 _connectionErrorCount) = 0;
-  virtual void lastConnectionErrorTimeChanged(const QDateTime& _lastConnectionErrorTime) = 0;
-};
-
-class IPoolMiner {
-public:
-  enum State {
-    STATE_STOPPED, STATE_RUNNING, STATE_ERROR
-  };
-
-  virtual ~IPoolMiner() {}
-
-  virtual void start(quint32 _coreCount) = 0;
-  virtual void stop() = 0;
-
-  virtual QString getPoolHost() const = 0;
-  virtual quint16 getPoolPort() const = 0;
-
-  virtual State getCurrentState() const = 0;
-  virtual quint32 getHashRate() const = 0;
-  virtual quint32 getAlternateHashRate() const = 0;
-  virtual quint32 getDifficulty() const = 0;
-  virtual quint32 getGoodShareCount() const = 0;
-  virtual quint32 getGoodAlternateShareCount() const = 0;
-  virtual quint32 getBadShareCount() const = 0;
-  virtual quint32 getConnectionErrorCount() const = 0;
-  virtual QDateTime getLastConnectionErrorTime() const = 0;
-
-  virtual void setAlternateAccount(const QString& _login, quint32 _probability) = 0;
-  virtual void unsetAlternateAccount() = 0;
-
-  virtual void addObserver(IPoolMinerObserver* _observer) = 0;
-  virtual void removeObserver(IPoolMinerObserver* _observer) = 0;
-};
-
-}
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#pragma once
+
+#include <QObject>
+
+namespace WalletGUI {
+
+class LatencyHistogram;
+
+enum class HashRateWindow : int {
+  SECONDS_10, SECONDS_60, MINUTES_15
+};
+
+// Pool responsiveness as seen by a miner. Times are in milliseconds; submitTime is the mean share
+// acknowledgement time and stays 0 until the miner has submitted shares to the pool.
+struct PoolLatency {
+  bool isMeasured;
+  double connectTime;
+  double loginTime;
+  double submitTime;
+  double rejectRate;
+  quint32 failedProbeCount;
+};
+
+class IPoolMinerObserver {
+public:
+  virtual ~IPoolMinerObserver() {}
+  virtual void stateChanged(int _newState) = 0;
+  virtual void hashRateChanged(quint32 _hashRate) = 0;
+  virtual void alternateHashRateChanged(quint32 _hashRate) = 0;
+  virtual void difficultyChanged(quint32 _difficulty) = 0;
+  virtual void goodShareCountChanged(quint32 _goodShareCount) = 0;
+  virtual void goodAlternateShareCountChanged(quint32 _goodShareCount) = 0;
+  virtual void badShareCountChanged(quint32 _badShareCount) = 0;
+  virtual void staleShareCountChanged(quint32 _staleShareCount) = 0;
+  virtual void connectionErrorCountChanged(quint32 _connectionErrorCount) = 0;
+  virtual void lastConnectionErrorTimeChanged(const QDateTime& _lastConnectionErrorTime) = 0;
+};
+
+class IPoolMiner {
+public:
+  enum State {
+    STATE_STOPPED, STATE_RUNNING, STATE_ERROR
+  };
+
+  virtual ~IPoolMiner() {}
+
+  virtual void start() = 0;
+  virtual void stop() = 0;
+
+  // Connects and logs in to measure the pool without starting workers. Only for stopped miners.
+  virtual void probe() = 0;
+  virtual void cancelProbe() = 0;
+  virtual bool isProbing() const = 0;
+  virtual PoolLatency getPoolLatency() const = 0;
+
+  // Keeps a stopped miner logged in with a current job, so that start() only has to start workers.
+  virtual void startStandby() = 0;
+  virtual void stopStandby() = 0;
+  virtual bool isStandby() const = 0;
+  virtual bool isStandbyReady() const = 0;
+
+  virtual QString getPoolHost() const = 0;
+  virtual quint16 getPoolPort() const = 0;
+
+  virtual State getCurrentState() const = 0;
+  virtual quint32 getHashRate() const = 0;
+  virtual quint32 getAlternateHashRate() const = 0;
+  virtual quint32 getAlternateProbability() const = 0;
+  virtual double getAlternateHashShare(HashRateWindow _window) const = 0;
+  virtual double getAverageHashRate(HashRateWindow _window) const = 0;
+  virtual double getEwmaHashRate() const = 0;
+  virtual QList<double> getWorkerHashRates() const = 0;
+  virtual quint32 getDifficulty() const = 0;
+  virtual quint32 getGoodShareCount() const = 0;
+  virtual quint32 getGoodAlternateShareCount() const = 0;
+  virtual quint32 getBadShareCount() const = 0;
+  virtual quint32 getStaleShareCount() const = 0;
+  virtual double getSubmitLatency(double _fraction) const = 0;
+  virtual const LatencyHistogram& getSubmitLatencyHistogram() const = 0;
+  virtual quint32 getConnectionErrorCount() const = 0;
+  virtual QDateTime getLastConnectionErrorTime() const = 0;
+
+  virtual void setAlternateAccount(const QString& _login, quint32 _probability) = 0;
+  virtual void unsetAlternateAccount() = 0;
+  // Picks the login difficulty from the measured hash rate so that the pool sees about
+  // _sharesPerMinute shares a minute, logging in again once the ideal difficulty is more than
+  // _driftThreshold percent away from the current one. 0 shares a minute turns tuning off.
+  virtual void setAutoDifficulty(quint32 _sharesPerMinute, quint32 _driftThreshold) = 0;
+
+  virtual void addObserver(IPoolMinerObserver* _observer) = 0;
+  virtual void removeObserver(IPoolMinerObserver* _observer) = 0;
+};
+
+}
@@ -1,413 +1,456 @@
-// Copyright (c) 2015-2018, The Bytecoin developers.
-// Licensed under the GNU Lesser General Public License. See LICENSE for details.
-
-#include <QAuthenticator>
-
-#include "JsonRpcClient.h"
-#include "common.h"
-#include "rpcapi.h"
-
-using namespace std::placeholders;
-
-namespace JsonRpc
-{
-
-constexpr char DEFAULT_RPC_PATH[] = "/json_rpc";
-
-//namespace
-//{
-
-//template<typename... Ts>
-//struct MapFromArgsMaker;
-
-//template<typename NameType, typename ValueType, typename... Ts>
-//struct MapFromArgsMaker<NameType, ValueType, Ts...>
-//{
-//    static
-//    QVariantMap make(NameType&& name, ValueType&& value, Ts&&... args)
-//    {
-//        QVariantMap map = MapFromArgsMaker<Ts...>::make(std::forward<Ts>(args)...);
-//        map.insert(std::forward<NameType>(name), QVariant(std::forward<ValueType>(value)));
-//        return map;
-//    }
-//};
-
-//template<>
-//struct MapFromArgsMaker<>
-//{
-//    static
-//    QVariantMap make()
-//    {
-//        return QVariantMap();
-//    }
-//};
-
-//}
-
-Client::Client(const QUrl& url, QObject* parent)
-    : Client(parent)
-{
-    setUrl(url);
-}
-
-Client::Client(const QString& endPoint, QObject* parent)
-    : Client(parent)
-{
-    setUrl(endPoint);
-}
-
-Client::Client(QObject* parent)
-    : QObject(parent)
-    , httpClient_(new QNetworkAccessManager(this))
-    , idCount_(0)
-{
-    connect(httpClient_, SIGNAL(finished(QNetworkReply*)), this, SLOT(replyFinished(QNetworkReply*)));
-    connect(httpClient_, &QNetworkAccessManager::authenticationRequired, this, &Client::authenticationRequired);
-}
-
-void Client::setUrl(const QString& endPoint)
-{
-    QUrl url = QUrl::fromUserInput(endPoint);
-    url.setScheme("http");
-    url.setPath(DEFAULT_RPC_PATH);
-    qDebug("[JsonRpcClient] Set url to %s", qPrintable(url.toDisplayString()));
-    url_ = std::move(url);
-}
-
-void Client::setUrl(const QUrl& url)
-{
-    qDebug("[JsonRpcClient] Set url to %s", qPrintable(url.toDisplayString()));
-    url_ = url;
-}
-
-void Client::insertResponseHandler(const QString& id, FunctionHandler handler)
-{
-    Q_ASSERT(!responseHandlers_.contains(id));
-    responseHandlers_.insert(id, handler);
-}
-
-//template<typename... Ts>
-//QString Client::sendRequest(QString method, Ts&&... args)
-//{
-//    JsonRpcRequest req;
-//    req.setId(QString::number(idCount_++));
-//    req.setMethod(method);
-//    req.setParamsFromObject(MapFromArgsMaker<Ts...>::make(std::forward<Ts>(args)...));
-
-//    sendJson(req.toString());
-
-//    return req.getId();
-//}
-
-QString Client::sendRequest(const QString& method, const QVariantMap& json)
-{
-    JsonRpcRequest req;
-    req.setId(QString::number(idCount_++));
-    req.setMethod(method);
-    req.setParamsFromObject(json);
-
-    sendJson(req.toString());
-
-    return req.getId();
-}
-
-//void Client::destroyedReply(QObject* obj)
-//{
-//    qDebug("[JsonRpcClient] Reply %p deleted.", (void*)obj);
-//}
-
-void Client::replyFinished(QNetworkReply* reply)
-{
-//    qDebug("[JsonRpcClient] Reply %p received.", (void*)reply);
-    reply->deleteLater();
-//    connect(reply, &QNetworkReply::destroyed, this, &Client::destroyedReply);
-
-    const QByteArray data = reply->readAll();
-    if (reply->error() != QNetworkReply::NoError)
-    {
-        qDebug("[JsonRpcClient] Network error. %s", qPrintable(reply->errorString()));
-        emit networkError(reply->errorString());
-        return;
-    }
-
-    emit packetReceived(data);
-
-    QJsonParseError parseError;
-    QJsonDocument jsonDocument = QJsonDocument::fromJson(data, &parseError);
-    if (parseError.error != QJsonParseError::NoError)
-    {
-        qDebug("[JsonRpcClient] Parse error %s", qPrintable(parseError.errorString()));
-        emit jsonParsingError(parseError.errorString());
-        return;
-    }
-
-    if (!jsonDocument.isObject())
-    {
-        qDebug("[JsonRpcClient] JSON document is not an object.");
-        emit jsonParsingError(tr("JSON document is not an object."));
-        return;
-    }
-    const QJsonObject json = jsonDocument.object();
-
-    int errorCode = 0;
-    QString errorString;
-    QString errorData;
-    QScopedPointer<JsonRpcObject> jsonRpcObject(JsonRpcObjectFactory::createJsonRpcObject(json, errorCode, errorString, errorData));
-    if (jsonRpcObject.isNull())
-    {
-        qDebug("[JsonRpcClient] Failed to create JsonRpcObject (%d) %s:%s", errorCode, qPrintable(errorString), qPrintable(errorData));
-        emit jsonParsingError(errorString);
-        return;
-    }
-    if (jsonRpcObject->isResponse())
-    {
-        const JsonRpcResponse& response = static_cast<JsonRpcResponse&>(*jsonRpcObject);
-        auto it = responseHandlers_.find(response.getId());
-//        if (response.isErrorResponse())
-//        {
-//            qDebug("[JsonRpcClient] Error response for %s id. %s", qPrintable(response.getId()), qPrintable(response.getErrorMessage()));
-//            if (it != responseHandlers_.end())
-//                responseHandlers_.erase(it);
-//            emit jsonErrorResponse(response.getId(), response.getErrorMessage());
-//            return;
-//        }
-        if (it == responseHandlers_.end())
-        {
-            qDebug("[JsonRpcClient] Cannot find handler for id '%s'.", qPrintable(response.getId()));
-            emit jsonUnknownMessageId(response.getId());
-            return;
-        }
-//        const QVariantMap result = response.getResultAsObject();
-//        it.value()(result);
-        it.value()(response);
-        responseHandlers_.erase(it);
-    }
-}
-
-void Client::authenticationRequired(QNetworkReply* /*reply*/, QAuthenticator* authenticator)
-{
-    emit authRequiredSignal(authenticator);
-}
-
-void Client::sendJson(const QByteArray& json)
-{
-//    Q_ASSERT(!url_.isEmpty());
-    static const QString jsonContentType("application/json-rpc");
-    static const QByteArray acceptHeaderName("Accept");
-    QNetworkRequest request(url_);
-    request.setHeader(QNetworkRequest::ContentTypeHeader, jsonContentType);
-    request.setRawHeader(acceptHeaderName, jsonContentType.toLatin1());
-
-    request.setAttribute(QNetworkRequest::CacheLoadControlAttribute, QNetworkRequest::AlwaysNetwork);
-    request.setAttribute(QNetworkRequest::CacheSaveControlAttribute, false);
-    request.setAttribute(QNetworkRequest::DoNotBufferUploadDataAttribute, true);
-    request.setAttribute(QNetworkRequest::HttpPipeliningAllowedAttribute, false);
-
-    httpClient_->post(request, json);
-
-    emit packetSent(json);
-}
-
-
-WalletClient::WalletClient(QObject* parent)
-    : Client(parent)
-{}
-
-WalletClient::WalletClient(const QUrl& url, QObject* parent)
-    : Client(url, parent)
-{}
-
-WalletClient::WalletClient(const QString& endPoint, QObject* parent)
-    : Client(endPoint, parent)
-{}
-
-void WalletClient::sendGetStatus(const RpcApi::GetStatus::Request& req)
-{
-    const QString requestID = sendRequest(RpcApi::GetStatus::METHOD, req.toJson());
-    insertResponseHandler(requestID, std::bind(&WalletClient::statusHandler, this, _1));
-}
-
-//void WalletClient::sendGetHistory(const QList<QString>& addresses, quint32 blockIndex, quint32 blockCount)
-//{
-//    const QString requestID = sendRequest(RpcApi::GetHistory::METHOD
-//            , GetHistory::Request::ADDRESSES, addresses
-//            , GetHistory::Request::BLOCK_INDEX, blockIndex
-//            , GetHistory::Request::BLOCK_COUNT, blockCount);
-//    insertResponseHandler(requestID, std::bind(&WalletClient::historyHandler, this, _1));
-//}
-
-void WalletClient::sendGetTransfers(const RpcApi::GetTransfers::Request& req)
-{
-    const QString requestID = sendRequest(RpcApi::GetTransfers::METHOD, req.toJson());
-    insertResponseHandler(requestID, std::bind(&WalletClient::transfersHandler, this, _1));
-}
-
-void WalletClient::sendGetAddresses()
-{
-    const QString requestID = sendRequest(RpcApi::GetAddresses::METHOD);
-    insertResponseHandler(requestID, std::bind(&WalletClient::addressesHandler, this, _1));
-}
-
-void WalletClient::sendGetViewKey()
-{
-    const QString requestID = sendRequest(RpcApi::GetViewKey::METHOD);
-    insertResponseHandler(requestID, std::bind(&WalletClient::viewKeyHandler, this, _1));
-}
-
-void WalletClient::sendGetBalance(const RpcApi::GetBalance::Request& req)
-{
-    const QString requestID = sendRequest(RpcApi::GetBalance::METHOD, req.toJson());
-    insertResponseHandler(requestID, std::bind(&WalletClient::balanceHandler, this, _1));
-}
-
-//void WalletClient::sendGetUnspent(const RpcApi::GetUnspent::Request& /*req*/)
-//{
-//    const QString requestID = sendRequest(RpcApi::GetUnspent::METHOD, req.toJson());
-//    insertResponseHandler(requestID, std::bind(&WalletClient::unspentHandler, this, _1));
-//}
-
-void WalletClient::sendCreateTx(const RpcApi::CreateTransaction::Request& req)
-{
-    const QString requestID = sendRequest(RpcApi::CreateTransaction::METHOD, req.toJson());
-    insertResponseHandler(requestID, std::bind(&WalletClient::createTxHandler, this, _1));
-}
-
-void WalletClient::sendSendTx(const RpcApi::SendTransaction::Request& req)
-{
-    const QString requestID = sendRequest(RpcApi::SendTransaction::METHOD, req.toJson());
-    insertResponseHandler(requestID, std::bind(&WalletClient::sendTxHandler, this, _1));
-}
-
-void WalletClient::sendCreateProof(const RpcApi::CreateSendProof::Request& req)
-{
-    const QString requestID = sendRequest(RpcApi::CreateSendProof::METHOD, req.toJson());
-    insertResponseHandler(requestID, std::bind(&WalletClient::proofsHandler, this, _1));
-}
-
-void WalletClient::sendCheckProof(const RpcApi::CheckSendProof::Request& req)
-{
-    const QString requestID = sendRequest(RpcApi::CheckSendProof::METHOD, req.toJson());
-    insertResponseHandler(requestID, std::bind(&WalletClient::checkProofHandler, this, _1));
-}
-
-void WalletClient::statusHandler(const JsonRpcResponse& response)
-{
-    if (response.isErrorResponse())
-    {
-        qDebug("[JsonRpcClient] Error response for %s id. %s", qPrintable(response.getId()), qPrintable(response.getErrorMessage()));
-        emit jsonErrorResponse(response.getId(), response.getErrorMessage());
-        return;
-    }
-
-    const QVariantMap result = response.getResultAsObject();
-    emit statusReceived(RpcApi::Status::fromJson(result));
-}
-
-void WalletClient::transfersHandler(const JsonRpcResponse& response)
-{
-    if (response.isErrorResponse())
-    {
-        qDebug("[JsonRpcClient] Error response for %s id. %s", qPrintable(response.getId()), qPrintable(response.getErrorMessage()));
-        emit jsonErrorResponse(response.getId(), response.getErrorMessage());
-        return;
-    }
-
-    const QVariantMap result = response.getResultAsObject();
-    emit transfersReceived(RpcApi::Transfers::fromJson(result));
-}
-
-void WalletClient::addressesHandler(const JsonRpcResponse& response)
-{
-    if (response.isErrorResponse())
-    {
-        qDebug("[JsonRpcClient] Error response for %s id. %s", qPrintable(response.getId()), qPrintable(response.getErrorMessage()));
-        emit jsonErrorResponse(response.getId(), response.getErrorMessage());
-        return;
-    }
-
-    const QVariantMap result = response.getResultAsObject();
-    emit addressesReceived(RpcApi::Addresses::fromJson(result));
-}
-
-void WalletClient::balanceHandler(const JsonRpcResponse& response)
-{
-    if (response.isErrorResponse())
-    {
-        qDebug("[JsonRpcClient] Error response for %s id. %s", qPrintable(response.getId()), qPrintable(response.getErrorMessage()));
-        emit jsonErrorResponse(response.getId(), response.getErrorMessage());
-        return;
-    }
-
-    const QVariantMap result = response.getResultAsObject();
-    emit balanceReceived(RpcApi::Balance::fromJson(result));
-}
-
-void WalletClient::createTxHandler(const JsonRpcResponse& response)
-{
-    if (response.isErrorResponse())
-    {
-        qDebug("[JsonRpcClient] Error response for %s id. %s", qPrintable(response.getId()), qPrintable(response.getErrorMessage()));
-        emit jsonErrorResponse(response.getId(), response.getErrorMessage());
-        return;
-    }
-
-    const QVariantMap result = response.getResultAsObject();
-    emit createTxReceived(RpcApi::CreatedTx::fromJson(result));
-}
-
-void WalletClient::sendTxHandler(const JsonRpcResponse& response)
-{
-    if (response.isErrorResponse())
-    {
-        qDebug("[JsonRpcClient] Error response for %s id. %s", qPrintable(response.getId()), qPrintable(response.getErrorMessage()));
-        emit jsonErrorResponse(response.getId(), response.getErrorMessage());
-        return;
-    }
-
-    const QVariantMap result = response.getResultAsObject();
-    emit sendTxReceived(RpcApi::SentTx::fromJson(result));
-}
-
-void WalletClient::viewKeyHandler(const JsonRpcResponse& response)
-{
-    if (response.isErrorResponse())
-    {
-        qDebug("[JsonRpcClient] Error response for %s id. %s", qPrintable(response.getId()), qPrintable(response.getErrorMessage()));
-        emit jsonErrorResponse(response.getId(), response.getErrorMessage());
-        return;
-    }
-
-    const QVariantMap result = response.getResultAsObject();
-    emit viewKeyReceived(RpcApi::ViewKey::fromJson(result));
-}
-
-void WalletClient::proofsHandler(const JsonRpcResponse& response)
-{
-    if (response.isErrorResponse())
-    {
-        qDebug("[JsonRpcClient] Error response for %s id. %s", qPrintable(response.getId()), qPrintable(response.getErrorMessage()));
-        emit jsonErrorResponse(response.getId(), response.getErrorMessage());
-        return;
-    }
-
-    const QVariantMap result = response.getResultAsObject();
-    emit proofsReceived(RpcApi::Proofs::fromJson(result));
-}
-
-void WalletClient::checkProofHandler(const JsonRpcResponse& response)
-{
-    if (response.isErrorResponse())
-    {
-        RpcApi::ProofCheck pc{response.getErrorMessage()};
-        emit checkProofReceived(pc);
-        return;
-    }
-
-    const QVariantMap result = response.getResultAsObject();
-    emit checkProofReceived(RpcApi::ProofCheck::fromJson(result));
-}
-
-
-//#undef CHECK_CONVERTIBLE
-
-}
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#include <QAuthenticator>
+
+#include "JsonRpcClient.h"
+#include "Trace/TraceRecorder.h"
+#include "common.h"
+#include "rpcapi.h"
+
+using namespace std::placeholders;
+
+namespace JsonRpc
+{
+
+constexpr char DEFAULT_RPC_PATH[] = "/json_rpc";
+
+//namespace
+//{
+
+//template<typename... Ts>
+//struct MapFromArgsMaker;
+
+//template<typename NameType, typename ValueType, typename... Ts>
+//struct MapFromArgsMaker<NameType, ValueType, Ts...>
+//{
+//    static
+//    QVariantMap make(NameType&& name, ValueType&& value, Ts&&... args)
+//    {
+//        QVariantMap map = MapFromArgsMaker<Ts...>::make(std::forward<Ts>(args)...);
+//        map.insert(std::forward<NameType>(name), QVariant(std::forward<ValueType>(value)));
+//        return map;
+//    }
+//};
+
+//template<>
+//struct MapFromArgsMaker<>
+//{
+//    static
+//    QVariantMap make()
+//    {
+//        return QVariantMap();
+//    }
+//};
+
+//}
+
+Client::Client(const QUrl& url, QObject* parent)
+    : Client(parent)
+{
+    setUrl(url);
+}
+
+Client::Client(const QString& endPoint, QObject* parent)
+    : Client(parent)
+{
+    setUrl(endPoint);
+}
+
+Client::Client(QObject* parent)
+    : QObject(parent)
+    , httpClient_(new QNetworkAccessManager(this))
+    , idCount_(0)
+{
+    clock_.start();
+    connect(httpClient_, SIGNAL(finished(QNetworkReply*)), this, SLOT(replyFinished(QNetworkReply*)));
+    connect(httpClient_, &QNetworkAccessManager::authenticationRequired, this, &Client::authenticationRequired);
+}
+
+void Client::setUrl(const QString& endPoint)
+{
+    QUrl url = QUrl::fromUserInput(endPoint);
+    url.setScheme("http");
+    url.setPath(DEFAULT_RPC_PATH);
+    qDebug("[JsonRpcClient] Set url to %s", qPrintable(url.toDisplayString()));
+    url_ = std::move(url);
+}
+
+void Client::setUrl(const QUrl& url)
+{
+    qDebug("[JsonRpcClient] Set url to %s", qPrintable(url.toDisplayString()));
+    url_ = url;
+}
+
+const QMap<QString, MethodStatistics>& Client::getMethodStatistics() const
+{
+    return methodStatistics_;
+}
+
+void Client::resetMethodStatistics()
+{
+    methodStatistics_.clear();
+}
+
+void Client::insertResponseHandler(const QString& id, FunctionHandler handler)
+{
+    Q_ASSERT(!responseHandlers_.contains(id));
+    responseHandlers_.insert(id, handler);
+}
+
+//template<typename... Ts>
+//QString Client::sendRequest(QString method, Ts&&... args)
+//{
+//    JsonRpcRequest req;
+//    req.setId(QString::number(idCount_++));
+//    req.setMethod(method);
+//    req.setParamsFromObject(MapFromArgsMaker<Ts...>::make(std::forward<Ts>(args)...));
+
+//    sendJson(req.toString());
+
+//    return req.getId();
+//}
+
+QString Client::sendRequest(const QString& method, const QVariantMap& json)
+{
+    JsonRpcRequest req;
+    req.setId(QString::number(idCount_++));
+    req.setMethod(method);
+    req.setParamsFromObject(json);
+
+    const QByteArray data = req.toString();
+    QNetworkReply* reply = sendJson(data);
+    pendingRequests_.insert(reply, {method, clock_.nsecsElapsed(), data.size()});
+    MethodStatistics& statistics = methodStatistics_[method];
+    ++statistics.requestCount;
+    statistics.requestBytes += data.size();
+
+    return req.getId();
+}
+
+//void Client::destroyedReply(QObject* obj)
+//{
+//    qDebug("[JsonRpcClient] Reply %p deleted.", (void*)obj);
+//}
+
+void Client::replyFinished(QNetworkReply* reply)
+{
+    WalletGUI::TraceScope traceScope("JsonRpc::Client::replyFinished", "jsonrpc");
+//    qDebug("[JsonRpcClient] Reply %p received.", (void*)reply);
+    reply->deleteLater();
+//    connect(reply, &QNetworkReply::destroyed, this, &Client::destroyedReply);
+    const PendingRequest pendingRequest = pendingRequests_.take(reply);
+
+    const qint64 receivedTime = clock_.nsecsElapsed();
+    const bool isTracked = !pendingRequest.method.isEmpty();
+
+    const QByteArray data = reply->readAll();
+    if (reply->error() != QNetworkReply::NoError)
+    {
+        qDebug("[JsonRpcClient] Network error. %s", qPrintable(reply->errorString()));
+        if (isTracked)
+            ++methodStatistics_[pendingRequest.method].errorCount;
+        emit networkError(reply->errorString());
+        return;
+    }
+
+    if (isTracked)
+    {
+        MethodStatistics& statistics = methodStatistics_[pendingRequest.method];
+        statistics.latency.record(receivedTime - pendingRequest.sentTime);
+        statistics.responseBytes += data.size();
+        statistics.maxResponseBytes = qMax<quint64>(statistics.maxResponseBytes, data.size());
+    }
+
+    emit packetReceived(data);
+
+    const qint64 parseStartTime = clock_.nsecsElapsed();
+    QJsonParseError parseError;
+    QJsonDocument jsonDocument = QJsonDocument::fromJson(data, &parseError);
+    if (parseError.error != QJsonParseError::NoError)
+    {
+        qDebug("[JsonRpcClient] Parse error %s", qPrintable(parseError.errorString()));
+        emit jsonParsingError(parseError.errorString());
+        return;
+    }
+
+    if (!jsonDocument.isObject())
+    {
+        qDebug("[JsonRpcClient] JSON document is not an object.");
+        emit jsonParsingError(tr("JSON document is not an object."));
+        return;
+    }
+    const QJsonObject json = jsonDocument.object();
+
+    int errorCode = 0;
+    QString errorString;
+    QString errorData;
+    QScopedPointer<JsonRpcObject> jsonRpcObject(JsonRpcObjectFactory::createJsonRpcObject(json, errorCode, errorString, errorData));
+    if (jsonRpcObject.isNull())
+    {
+        qDebug("[JsonRpcClient] Failed to create JsonRpcObject (%d) %s:%s", errorCode, qPrintable(errorString), qPrintable(errorData));
+        emit jsonParsingError(errorString);
+        return;
+    }
+
+    if (isTracked)
+    {
+        const qint64 parseTime = clock_.nsecsElapsed() - parseStartTime;
+        methodStatistics_[pendingRequest.method].parseTime.record(parseTime);
+        emit requestFinished(pendingRequest.method, receivedTime - pendingRequest.sentTime, pendingRequest.requestSize, data.size(), parseTime);
+    }
+
+    if (jsonRpcObject->isResponse())
+    {
+        const JsonRpcResponse& response = static_cast<JsonRpcResponse&>(*jsonRpcObject);
+        auto it = responseHandlers_.find(response.getId());
+//        if (response.isErrorResponse())
+//        {
+//            qDebug("[JsonRpcClient] Error response for %s id. %s", qPrintable(response.getId()), qPrintable(response.getErrorMessage()));
+//            if (it != responseHandlers_.end())
+//                responseHandlers_.erase(it);
+//            emit jsonErrorResponse(response.getId(), response.getErrorMessage());
+//            return;
+//        }
+        if (it == responseHandlers_.end())
+        {
+            qDebug("[JsonRpcClient] Cannot find handler for id '%s'.", qPrintable(response.getId()));
+            emit jsonUnknownMessageId(response.getId());
+            return;
+        }
+//        const QVariantMap result = response.getResultAsObject();
+//        it.value()(result);
+        it.value()(response);
+        responseHandlers_.erase(it);
+    }
+}
+
+void Client::authenticationRequired(QNetworkReply* /*reply*/, QAuthenticator* authenticator)
+{
+    emit authRequiredSignal(authenticator);
+}
+
+QNetworkReply* Client::sendJson(const QByteArray& json)
+{
+    WalletGUI::TraceScope traceScope("JsonRpc::Client::sendJson", "jsonrpc");
+//    Q_ASSERT(!url_.isEmpty());
+    static const QString jsonContentType("application/json-rpc");
+    static const QByteArray acceptHeaderName("Accept");
+    QNetworkRequest request(url_);
+    request.setHeader(QNetworkRequest::ContentTypeHeader, jsonContentType);
+    request.setRawHeader(acceptHeaderName, jsonContentType.toLatin1());
+
+    request.setAttribute(QNetworkRequest::CacheLoadControlAttribute, QNetworkRequest::AlwaysNetwork);
+    request.setAttribute(QNetworkRequest::CacheSaveControlAttribute, false);
+    request.setAttribute(QNetworkRequest::DoNotBufferUploadDataAttribute, true);
+    request.setAttribute(QNetworkRequest::HttpPipeliningAllowedAttribute, false);
+
+    QNetworkReply* reply = httpClient_->post(request, json);
+
+    emit packetSent(json);
+    return reply;
+}
+
+
+WalletClient::WalletClient(QObject* parent)
+    : Client(parent)
+{}
+
+WalletClient::WalletClient(const QUrl& url, QObject* parent)
+    : Client(url, parent)
+{}
+
+WalletClient::WalletClient(const QString& endPoint, QObject* parent)
+    : Client(endPoint, parent)
+{}
+
+void WalletClient::sendGetStatus(const RpcApi::GetStatus::Request& req)
+{
+    const QString requestID = sendRequest(RpcApi::GetStatus::METHOD, req.toJson());
+    insertResponseHandler(requestID, std::bind(&WalletClient::statusHandler, this, _1));
+}
+
+//void WalletClient::sendGetHistory(const QList<QString>& addresses, quint32 blockIndex, quint32 blockCount)
+//{
+//    const QString requestID = sendRequest(RpcApi::GetHistory::METHOD
+//            , GetHistory::Request::ADDRESSES, addresses
+//            , GetHistory::Request::BLOCK_INDEX, blockIndex
+//            , GetHistory::Request::BLOCK_COUNT, blockCount);
+//    insertResponseHandler(requestID, std::bind(&WalletClient::historyHandler, this, _1));
+//}
+
+void WalletClient::sendGetTransfers(const RpcApi::GetTransfers::Request& req)
+{
+    const QString requestID = sendRequest(RpcApi::GetTransfers::METHOD, req.toJson());
+    insertResponseHandler(requestID, std::bind(&WalletClient::transfersHandler, this, _1));
+}
+
+void WalletClient::sendGetAddresses()
+{
+    const QString requestID = sendRequest(RpcApi::GetAddresses::METHOD);
+    insertResponseHandler(requestID, std::bind(&WalletClient::addressesHandler, this, _1));
+}
+
+void WalletClient::sendGetViewKey()
+{
+    const QString requestID = sendRequest(RpcApi::GetViewKey::METHOD);
+    insertResponseHandler(requestID, std::bind(&WalletClient::viewKeyHandler, this, _1));
+}
+
+void WalletClient::sendGetBalance(const RpcApi::GetBalance::Request& req)
+{
+    const QString requestID = sendRequest(RpcApi::GetBalance::METHOD, req.toJson());
+    insertResponseHandler(requestID, std::bind(&WalletClient::balanceHandler, this, _1));
+}
+
+//void WalletClient::sendGetUnspent(const RpcApi::GetUnspent::Request& /*req*/)
+//{
+//    const QString requestID = sendRequest(RpcApi::GetUnspent::METHOD, req.toJson());
+//    insertResponseHandler(requestID, std::bind(&WalletClient::unspentHandler, this, _1));
+//}
+
+void WalletClient::sendCreateTx(const RpcApi::CreateTransaction::Request& req)
+{
+    const QString requestID = sendRequest(RpcApi::CreateTransaction::METHOD, req.toJson());
+    insertResponseHandler(requestID, std::bind(&WalletClient::createTxHandler, this, _1));
+}
+
+void WalletClient::sendSendTx(const RpcApi::SendTransaction::Request& req)
+{
+    const QString requestID = sendRequest(RpcApi::SendTransaction::METHOD, req.toJson());
+    insertResponseHandler(requestID, std::bind(&WalletClient::sendTxHandler, this, _1));
+}
+
+void WalletClient::sendCreateProof(const RpcApi::CreateSendProof::Request& req)
+{
+    const QString requestID = sendRequest(RpcApi::CreateSendProof::METHOD, req.toJson());
+    insertResponseHandler(requestID, std::bind(&WalletClient::proofsHandler, this, _1));
+}
+
+void WalletClient::sendCheckProof(const RpcApi::CheckSendProof::Request& req)
+{
+    const QString requestID = sendRequest(RpcApi::CheckSendProof::METHOD, req.toJson());
+    insertResponseHandler(requestID, std::bind(&WalletClient::checkProofHandler, this, _1));
+}
+
+void WalletClient::statusHandler(const JsonRpcResponse& response)
+{
+    if (response.isErrorResponse())
+    {
+        qDebug("[JsonRpcClient] Error response for %s id. %s", qPrintable(response.getId()), qPrintable(response.getErrorMessage()));
+        emit jsonErrorResponse(response.getId(), response.getErrorMessage());
+        return;
+    }
+
+    const QVariantMap result = response.getResultAsObject();
+    emit statusReceived(RpcApi::Status::fromJson(result));
+}
+
+void WalletClient::transfersHandler(const JsonRpcResponse& response)
+{
+    if (response.isErrorResponse())
+    {
+        qDebug("[JsonRpcClient] Error response for %s id. %s", qPrintable(response.getId()), qPrintable(response.getErrorMessage()));
+        emit jsonErrorResponse(response.getId(), response.getErrorMessage());
+        return;
+    }
+
+    const QVariantMap result = response.getResultAsObject();
+    emit transfersReceived(RpcApi::Transfers::fromJson(result));
+}
+
+void WalletClient::addressesHandler(const JsonRpcResponse& response)
+{
+    if (response.isErrorResponse())
+    {
+        qDebug("[JsonRpcClient] Error response for %s id. %s", qPrintable(response.getId()), qPrintable(response.getErrorMessage()));
+        emit jsonErrorResponse(response.getId(), response.getErrorMessage());
+        return;
+    }
+
+    const QVariantMap result = response.getResultAsObject();
+    emit addressesReceived(RpcApi::Addresses::fromJson(result));
+}
+
+void WalletClient::balanceHandler(const JsonRpcResponse& response)
+{
+    if (response.isErrorResponse())
+    {
+        qDebug("[JsonRpcClient] Error response for %s id. %s", qPrintable(response.getId()), qPrintable(response.getErrorMessage()));
+        emit jsonErrorResponse(response.getId(), response.getErrorMessage());
+        return;
+    }
+
+    const QVariantMap result = response.getResultAsObject();
+    emit balanceReceived(RpcApi::Balance::fromJson(result));
+}
+
+void WalletClient::createTxHandler(const JsonRpcResponse& response)
+{
+    if (response.isErrorResponse())
+    {
+        qDebug("[JsonRpcClient] Error response for %s id. %s", qPrintable(response.getId()), qPrintable(response.getErrorMessage()));
+        emit jsonErrorResponse(response.getId(), response.getErrorMessage());
+        return;
+    }
+
+    const QVariantMap result = response.getResultAsObject();
+    emit createTxReceived(RpcApi::CreatedTx::fromJson(result));
+}
+
+void WalletClient::sendTxHandler(const JsonRpcResponse& response)
+{
+    if (response.isErrorResponse())
+    {
+        qDebug("[JsonRpcClient] Error response for %s id. %s", qPrintable(response.getId()), qPrintable(response.getErrorMessage()));
+        emit jsonErrorResponse(response.getId(), response.getErrorMessage());
+        return;
+    }
+
+    const QVariantMap result = response.getResultAsObject();
+    emit sendTxReceived(RpcApi::SentTx::fromJson(result));
+}
+
+void WalletClient::viewKeyHandler(const JsonRpcResponse& response)
+{
+    if (response.isErrorResponse())
+    {
+        qDebug("[JsonRpcClient] Error response for %s id. %s", qPrintable(response.getId()), qPrintable(response.getErrorMessage()));
+        emit jsonErrorResponse(response.getId(), response.getErrorMessage());
+        return;
+    }
+
+    const QVariantMap result = response.getResultAsObject();
+    emit viewKeyReceived(RpcApi::ViewKey::fromJson(result));
+}
+
+void WalletClient::proofsHandler(const JsonRpcResponse& response)
+{
+    if (response.isErrorResponse())
+    {
+        qDebug("[JsonRpcClient] Error response for %s id. %s", qPrintable(response.getId()), qPrintable(response.getErrorMessage()));
+        emit jsonErrorResponse(response.getId(), response.getErrorMessage());
+        return;
+    }
+
+    const QVariantMap result = response.getResultAsObject();
+    emit proofsReceived(RpcApi::Proofs::fromJson(result));
+}
+
+void WalletClient::checkProofHandler(const JsonRpcResponse& response)
+{
+    if (response.isErrorResponse())
+    {
+        RpcApi::ProofCheck pc{response.getErrorMessage()};
+        emit checkProofReceived(pc);
+        return;
+    }
+
+    const QVariantMap result = response.getResultAsObject();
+    emit checkProofReceived(RpcApi::ProofCheck::fromJson(result));
+}
+
+
+//#undef CHECK_CONVERTIBLE
+
+}
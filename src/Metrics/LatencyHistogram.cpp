@@ -0,0 +1,79 @@
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#include <limits>
+
+#include "LatencyHistogram.h"
+
+namespace WalletGUI {
+
+namespace {
+
+const double BUCKET_UPPER_BOUNDS[] = {1, 2, 5, 10, 20, 50, 100, 200, 500, 1000, 2000, 5000, 10000};
+const int BUCKET_BOUND_COUNT = sizeof(BUCKET_UPPER_BOUNDS) / sizeof(BUCKET_UPPER_BOUNDS[0]);
+const double NANOSECONDS_PER_MILLISECOND = 1e6;
+
+}
+
+LatencyHistogram::LatencyHistogram() : m_bucketCounts(getBucketCount(), 0), m_count(0), m_sum(0) {
+}
+
+LatencyHistogram::~LatencyHistogram() {
+}
+
+int LatencyHistogram::getBucketCount() {
+  return BUCKET_BOUND_COUNT + 1;
+}
+
+double LatencyHistogram::getBucketUpperBound(int _bucket) {
+  return _bucket < BUCKET_BOUND_COUNT ? BUCKET_UPPER_BOUNDS[_bucket] : std::numeric_limits<double>::infinity();
+}
+
+void LatencyHistogram::record(qint64 _latency) {
+  const double latency = qMax<qint64>(_latency, 0) / NANOSECONDS_PER_MILLISECOND;
+  int bucket = 0;
+  while (bucket < BUCKET_BOUND_COUNT && latency > BUCKET_UPPER_BOUNDS[bucket]) {
+    ++bucket;
+  }
+
+  ++m_bucketCounts[bucket];
+  ++m_count;
+  m_sum += latency;
+}
+
+void LatencyHistogram::reset() {
+  m_bucketCounts.fill(0);
+  m_count = 0;
+  m_sum = 0;
+}
+
+quint64 LatencyHistogram::getCount() const {
+  return m_count;
+}
+
+quint64 LatencyHistogram::getBucketSampleCount(int _bucket) const {
+  return m_bucketCounts[_bucket];
+}
+
+double LatencyHistogram::getSum() const {
+  return m_sum;
+}
+
+double LatencyHistogram::getPercentile(double _fraction) const {
+  if (m_count == 0) {
+    return 0;
+  }
+
+  const quint64 rank = qMax<quint64>(1, static_cast<quint64>(qBound(0.0, _fraction, 1.0) * m_count + 0.5));
+  quint64 seen = 0;
+  for (int bucket = 0; bucket < m_bucketCounts.size(); ++bucket) {
+    seen += m_bucketCounts[bucket];
+    if (seen >= rank) {
+      return getBucketUpperBound(bucket);
+    }
+  }
+
+  return getBucketUpperBound(BUCKET_BOUND_COUNT);
+}
+
+}
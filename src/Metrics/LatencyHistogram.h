@@ -0,0 +1,35 @@
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#pragma once
+
+#include <QVector>
+
+namespace WalletGUI {
+
+// Fixed-bucket latency histogram. Bucket upper bounds follow a 1-2-5 series from 1 ms to 10 s, with a
+// final bucket for everything slower. Samples are recorded in nanoseconds; bounds, the sum and
+// percentiles are reported in milliseconds, a percentile being the upper bound of its bucket.
+class LatencyHistogram {
+public:
+  LatencyHistogram();
+  ~LatencyHistogram();
+
+  static int getBucketCount();
+  static double getBucketUpperBound(int _bucket);
+
+  void record(qint64 _latency);
+  void reset();
+
+  quint64 getCount() const;
+  quint64 getBucketSampleCount(int _bucket) const;
+  double getSum() const;
+  double getPercentile(double _fraction) const;
+
+private:
+  QVector<quint64> m_bucketCounts;
+  quint64 m_count;
+  double m_sum;
+};
+
+}
@@ -0,0 +1,125 @@
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#include <QHostAddress>
+#include <QTcpServer>
+#include <QTcpSocket>
+#include <QTimer>
+
+#include "MetricsServer.h"
+#include "MetricsWriter.h"
+#include "IMetricsSource.h"
+#include "logger.h"
+
+namespace WalletGUI {
+
+namespace {
+
+const qint64 MAX_REQUEST_SIZE = 8 * 1024;
+const int CONNECTION_TIMEOUT = 5000;
+const char METRICS_PATH[] = "/metrics";
+const char CONTENT_TYPE[] = "text/plain; version=0.0.4; charset=utf-8";
+
+}
+
+MetricsServer::MetricsServer(QObject* _parent) : QObject(_parent), m_server(new QTcpServer(this)), m_sources() {
+  connect(m_server, &QTcpServer::newConnection, this, &MetricsServer::newConnection);
+}
+
+MetricsServer::~MetricsServer() {
+}
+
+bool MetricsServer::start(quint16 _port) {
+  if (!m_server->listen(QHostAddress::LocalHost, _port)) {
+    WalletLogger::critical(tr("[Metrics] Can't listen on 127.0.0.1:%1: %2").arg(_port).arg(m_server->errorString()));
+    return false;
+  }
+
+  WalletLogger::info(tr("[Metrics] Serving http://127.0.0.1:%1%2").arg(_port).arg(METRICS_PATH));
+  return true;
+}
+
+void MetricsServer::stop() {
+  m_server->close();
+}
+
+bool MetricsServer::isListening() const {
+  return m_server->isListening();
+}
+
+void MetricsServer::addSource(const IMetricsSource* _source) {
+  if (!m_sources.contains(_source)) {
+    m_sources.append(_source);
+  }
+}
+
+void MetricsServer::removeSource(const IMetricsSource* _source) {
+  m_sources.removeAll(_source);
+}
+
+// A connection gets CONNECTION_TIMEOUT to send its request and take the response, and Qt buffers no
+// more than one byte past MAX_REQUEST_SIZE of it, so a client that never finishes its headers can
+// neither hold the socket nor grow the buffer.
+void MetricsServer::newConnection() {
+  while (QTcpSocket* socket = m_server->nextPendingConnection()) {
+    socket->setReadBufferSize(MAX_REQUEST_SIZE + 1);
+    connect(socket, &QTcpSocket::readyRead, this, [this, socket]() { readRequest(socket); });
+    connect(socket, &QTcpSocket::disconnected, socket, &QObject::deleteLater);
+    QTimer::singleShot(CONNECTION_TIMEOUT, socket, [socket]() {
+      WalletLogger::debug(tr("[Metrics] Closing a connection that timed out"));
+      socket->abort();
+      socket->deleteLater();
+    });
+  }
+}
+
+// Scrapers send a small GET without a body, so the request is complete once the header block ends.
+void MetricsServer::readRequest(QTcpSocket* _socket) {
+  const QByteArray data = _socket->peek(qMin(_socket->bytesAvailable(), MAX_REQUEST_SIZE + 1));
+  if (!data.contains("\r\n\r\n") && !data.contains("\n\n")) {
+    if (data.size() > MAX_REQUEST_SIZE) {
+      sendResponse(_socket, "431 Request Header Fields Too Large", QByteArray());
+    }
+
+    return;
+  }
+
+  _socket->readAll();
+  const QList<QByteArray> requestLine = data.left(data.indexOf('\n')).trimmed().split(' ');
+  if (requestLine.size() < 2 || requestLine[0] != "GET") {
+    sendResponse(_socket, "405 Method Not Allowed", QByteArray());
+    return;
+  }
+
+  const QByteArray path = requestLine[1].split('?').first();
+  if (path != METRICS_PATH) {
+    sendResponse(_socket, "404 Not Found", QByteArray());
+    return;
+  }
+
+  sendResponse(_socket, "200 OK", collectMetrics());
+}
+
+void MetricsServer::sendResponse(QTcpSocket* _socket, const QByteArray& _status, const QByteArray& _body) {
+  disconnect(_socket, &QTcpSocket::readyRead, this, nullptr);
+  QByteArray response = "HTTP/1.1 " + _status + "\r\n";
+  response.append("Content-Type: ").append(CONTENT_TYPE).append("\r\n");
+  response.append("Content-Length: ").append(QByteArray::number(_body.size())).append("\r\n");
+  response.append("Connection: close\r\n\r\n");
+  response.append(_body);
+  _socket->write(response);
+  _socket->disconnectFromHost();
+}
+
+QByteArray MetricsServer::collectMetrics() const {
+  MetricsWriter writer;
+  writer.addMetric("gdoge_log_queue_depth", MetricsWriter::GAUGE, "Log messages waiting for the logger thread.");
+  writer.addSample("gdoge_log_queue_depth", WalletLogger::getQueueDepth());
+  for (const IMetricsSource* source : m_sources) {
+    source->writeMetrics(writer);
+  }
+
+  return writer.toText();
+}
+
+}
@@ -0,0 +1,44 @@
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#pragma once
+
+#include <QList>
+#include <QObject>
+
+class QTcpServer;
+class QTcpSocket;
+
+namespace WalletGUI {
+
+class IMetricsSource;
+
+// Serves GET /metrics in the Prometheus text format on the loopback interface. Every scrape asks all
+// registered sources for their current values; nothing is sampled in between.
+class MetricsServer : public QObject {
+  Q_OBJECT
+  Q_DISABLE_COPY(MetricsServer)
+
+public:
+  explicit MetricsServer(QObject* _parent);
+  ~MetricsServer();
+
+  bool start(quint16 _port);
+  void stop();
+  bool isListening() const;
+
+  // Sources must outlive the server or be removed first.
+  void addSource(const IMetricsSource* _source);
+  void removeSource(const IMetricsSource* _source);
+
+private:
+  QTcpServer* m_server;
+  QList<const IMetricsSource*> m_sources;
+
+  void newConnection();
+  void readRequest(QTcpSocket* _socket);
+  void sendResponse(QTcpSocket* _socket, const QByteArray& _status, const QByteArray& _body);
+  QByteArray collectMetrics() const;
+};
+
+}
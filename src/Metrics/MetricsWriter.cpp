@@ -0,0 +1,102 @@
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#include <QtMath>
+
+#include "MetricsWriter.h"
+#include "LatencyHistogram.h"
+
+namespace WalletGUI {
+
+namespace {
+
+const double MILLISECONDS_PER_SECOND = 1000;
+
+QString escapeLabelValue(QString _value) {
+  return _value.replace('\\', "\\\\").replace('"', "\\\"").replace('\n', "\\n");
+}
+
+QString escapeHelp(QString _help) {
+  return _help.replace('\\', "\\\\").replace('\n', "\\n");
+}
+
+QString formatValue(double _value) {
+  if (qIsNaN(_value)) {
+    return "NaN";
+  } else if (qIsInf(_value)) {
+    return _value > 0 ? "+Inf" : "-Inf";
+  }
+
+  return QString::number(_value, 'g', 15);
+}
+
+const char* typeName(MetricsWriter::MetricType _type) {
+  switch (_type) {
+  case MetricsWriter::GAUGE:
+    return "gauge";
+  case MetricsWriter::COUNTER:
+    return "counter";
+  case MetricsWriter::HISTOGRAM:
+    return "histogram";
+  }
+
+  return "untyped";
+}
+
+}
+
+MetricsWriter::MetricsWriter() : m_families(), m_familyIndexes() {
+}
+
+void MetricsWriter::addMetric(const QString& _name, MetricType _type, const QString& _help) {
+  if (m_familyIndexes.contains(_name)) {
+    return;
+  }
+
+  m_familyIndexes.insert(_name, m_families.size());
+  m_families.append({_name, _type, _help, QStringList()});
+}
+
+void MetricsWriter::addSample(const QString& _name, double _value, const MetricLabels& _labels, const QString& _suffix) {
+  Q_ASSERT(m_familyIndexes.contains(_name));
+  QString sample = _name + _suffix;
+  if (!_labels.isEmpty()) {
+    QStringList labels;
+    for (const auto& label : _labels) {
+      labels.append(QString("%1=\"%2\"").arg(label.first, escapeLabelValue(label.second)));
+    }
+
+    sample.append(QString("{%1}").arg(labels.join(',')));
+  }
+
+  sample.append(' ').append(formatValue(_value));
+  m_families[m_familyIndexes.value(_name)].samples.append(sample);
+}
+
+void MetricsWriter::addHistogram(const QString& _name, const LatencyHistogram& _histogram, const MetricLabels& _labels) {
+  quint64 cumulativeCount = 0;
+  for (int bucket = 0; bucket < LatencyHistogram::getBucketCount(); ++bucket) {
+    cumulativeCount += _histogram.getBucketSampleCount(bucket);
+    MetricLabels labels = _labels;
+    labels.append(qMakePair(QString("le"), formatValue(LatencyHistogram::getBucketUpperBound(bucket) / MILLISECONDS_PER_SECOND)));
+    addSample(_name, cumulativeCount, labels, "_bucket");
+  }
+
+  addSample(_name, _histogram.getSum() / MILLISECONDS_PER_SECOND, _labels, "_sum");
+  addSample(_name, _histogram.getCount(), _labels, "_count");
+}
+
+QByteArray MetricsWriter::toText() const {
+  QString text;
+  for (const MetricFamily& family : m_families) {
+    text.append(QString("# HELP %1 %2\n").arg(family.name, escapeHelp(family.help)));
+    text.append(QString("# TYPE %1 %2\n").arg(family.name, QString(typeName(family.type))));
+    for (const QString& sample : family.samples) {
+      text.append(sample).append('\n');
+    }
+  }
+
+  return text.toUtf8();
+}
+
+}
@@ -0,0 +1,50 @@
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#pragma once
+
+#include <QHash>
+#include <QList>
+#include <QPair>
+#include <QString>
+#include <QStringList>
+
+namespace WalletGUI {
+
+class LatencyHistogram;
+
+typedef QList<QPair<QString, QString> > MetricLabels;
+
+// Builds one scrape in the Prometheus text exposition format. Samples are grouped under the HELP and
+// TYPE lines of their metric family no matter in which order the sources add them.
+class MetricsWriter {
+public:
+  enum MetricType {
+    GAUGE, COUNTER, HISTOGRAM
+  };
+
+  MetricsWriter();
+
+  // Declaring a family again is a no-op, so per-pool sources can declare inside their loops.
+  void addMetric(const QString& _name, MetricType _type, const QString& _help);
+  // _suffix selects a histogram series ("_bucket", "_sum", "_count"); plain metrics leave it empty.
+  void addSample(const QString& _name, double _value, const MetricLabels& _labels = MetricLabels(),
+    const QString& _suffix = QString());
+  // Writes a LatencyHistogram as a histogram in seconds.
+  void addHistogram(const QString& _name, const LatencyHistogram& _histogram, const MetricLabels& _labels = MetricLabels());
+
+  QByteArray toText() const;
+
+private:
+  struct MetricFamily {
+    QString name;
+    MetricType type;
+    QString help;
+    QStringList samples;
+  };
+
+  QList<MetricFamily> m_families;
+  QHash<QString, int> m_familyIndexes;
+};
+
+}
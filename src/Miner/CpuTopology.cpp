@@ -0,0 +1,288 @@
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#include <QDir>
+#include <QFile>
+#include <QMap>
+#include <QSet>
+#include <QStringList>
+#include <QThread>
+
+#include <algorithm>
+
+#if defined(Q_OS_LINUX)
+#include <pthread.h>
+#include <sched.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "CpuTopology.h"
+
+namespace WalletGUI {
+
+namespace {
+
+const char SYSFS_CPU_DIR[] = "/sys/devices/system/cpu";
+const char SYSFS_NODE_DIR[] = "/sys/devices/system/node";
+
+QString readSysfsFile(const QString& _path) {
+  QFile file(_path);
+  if (!file.open(QIODevice::ReadOnly)) {
+    return QString();
+  }
+
+  return QString::fromLatin1(file.readAll()).trimmed();
+}
+
+int readSysfsInt(const QString& _path, int _defaultValue) {
+  bool ok = false;
+  const int value = readSysfsFile(_path).toInt(&ok);
+  return ok ? value : _defaultValue;
+}
+
+// Parses the sysfs cpu list format, e.g. "0-3,8,10-11".
+QList<int> parseCpuList(const QString& _cpuList) {
+  QList<int> result;
+  for (const QString& range : _cpuList.split(',', QString::SkipEmptyParts)) {
+    const QStringList bounds = range.split('-');
+    bool firstOk = false;
+    bool lastOk = bounds.size() == 1;
+    const int first = bounds.first().toInt(&firstOk);
+    const int last = bounds.size() == 1 ? first : bounds.at(1).toInt(&lastOk);
+    if (!firstOk || !lastOk) {
+      continue;
+    }
+
+    for (int cpu = first; cpu <= last; ++cpu) {
+      result.append(cpu);
+    }
+  }
+
+  return result;
+}
+
+// Parses cache sizes such as "32768K" or "8M".
+quint64 parseCacheSize(const QString& _size) {
+  if (_size.isEmpty()) {
+    return 0;
+  }
+
+  quint64 multiplier = 1;
+  QString digits = _size;
+  if (_size.endsWith('K')) {
+    multiplier = 1024;
+    digits.chop(1);
+  } else if (_size.endsWith('M')) {
+    multiplier = 1024 * 1024;
+    digits.chop(1);
+  }
+
+  return digits.toULongLong() * multiplier;
+}
+
+}
+
+const CpuTopology& CpuTopology::instance() {
+  static CpuTopology topology;
+  return topology;
+}
+
+CpuTopology::CpuTopology() : m_l3DomainCount(1), m_l3CacheSize(0) {
+  detect();
+  if (m_cpus.isEmpty()) {
+    detectFallback();
+  }
+}
+
+const QList<CpuInfo>& CpuTopology::getCpus() const {
+  return m_cpus;
+}
+
+int CpuTopology::getL3DomainCount() const {
+  return m_l3DomainCount;
+}
+
+quint64 CpuTopology::getL3CacheSize() const {
+  return m_l3CacheSize;
+}
+
+QList<int> CpuTopology::getPlacement(quint32 _threadCount, const QList<int>& _excludedCpus) const {
+  const QSet<int> excludedCpus = _excludedCpus.toSet();
+  QList<CpuInfo> cpus;
+  for (const CpuInfo& cpuInfo : m_cpus) {
+    if (!excludedCpus.contains(cpuInfo.cpu)) {
+      cpus.append(cpuInfo);
+    }
+  }
+
+  // Order the CPUs by SMT sibling index first, so a second hardware thread of a core is only used once
+  // every usable core has one worker, then round-robin over L3 domains within each sibling level.
+  QMap<int, int> cpusTakenPerDomain;
+  QList<QPair<QPair<int, int>, int>> keys;
+  for (const CpuInfo& cpuInfo : cpus) {
+    const int positionInDomain = cpusTakenPerDomain[cpuInfo.siblingIndex * m_l3DomainCount + cpuInfo.l3Domain]++;
+    keys.append(qMakePair(qMakePair(cpuInfo.siblingIndex, positionInDomain), cpuInfo.l3Domain));
+  }
+
+  QList<int> order;
+  for (int i = 0; i < cpus.size(); ++i) {
+    order.append(i);
+  }
+
+  std::stable_sort(order.begin(), order.end(), [&keys](int _left, int _right) {
+    return keys[_left] < keys[_right];
+  });
+
+  QList<int> result;
+  if (order.isEmpty() || !isPinningSupported()) {
+    return result;
+  }
+
+  for (quint32 i = 0; i < _threadCount; ++i) {
+    result.append(cpus[order[i % order.size()]].cpu);
+  }
+
+  return result;
+}
+
+quint32 CpuTopology::getSuggestedThreadCount(quint64 _bytesPerThread, const QList<int>& _excludedCpus) const {
+  const QSet<int> excludedCpus = _excludedCpus.toSet();
+  QMap<int, quint32> coresPerDomain;
+  for (const CpuInfo& cpuInfo : m_cpus) {
+    if (cpuInfo.siblingIndex == 0 && !excludedCpus.contains(cpuInfo.cpu)) {
+      ++coresPerDomain[cpuInfo.l3Domain];
+    }
+  }
+
+  quint32 result = 0;
+  for (auto it = coresPerDomain.constBegin(); it != coresPerDomain.constEnd(); ++it) {
+    if (m_l3CacheSize == 0 || _bytesPerThread == 0) {
+      result += it.value();
+    } else {
+      result += std::min<quint64>(it.value(), m_l3CacheSize / _bytesPerThread);
+    }
+  }
+
+  return std::max<quint32>(result, 1);
+}
+
+bool CpuTopology::isPinningSupported() {
+#if defined(Q_OS_LINUX)
+  return true;
+#else
+  return false;
+#endif
+}
+
+bool CpuTopology::pinCurrentThread(int _cpu) {
+#if defined(Q_OS_LINUX)
+  if (_cpu < 0 || _cpu >= CPU_SETSIZE) {
+    return false;
+  }
+
+  cpu_set_t cpuSet;
+  CPU_ZERO(&cpuSet);
+  CPU_SET(_cpu, &cpuSet);
+  return pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet) == 0;
+#else
+  Q_UNUSED(_cpu);
+  return false;
+#endif
+}
+
+bool CpuTopology::setCurrentThreadPriority(bool _idle, int _niceLevel) {
+#if defined(Q_OS_LINUX)
+  sched_param param;
+  param.sched_priority = 0;
+  if (pthread_setschedparam(pthread_self(), _idle ? SCHED_IDLE : SCHED_OTHER, &param) != 0) {
+    return false;
+  }
+
+  // Linux keeps the nice value per thread, PRIO_PROCESS with a thread id only affects that thread.
+  return setpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)), _niceLevel) == 0;
+#else
+  Q_UNUSED(_idle);
+  Q_UNUSED(_niceLevel);
+  return false;
+#endif
+}
+
+void CpuTopology::detect() {
+#if defined(Q_OS_LINUX)
+  const QString cpuDir(SYSFS_CPU_DIR);
+  const QList<int> onlineCpus = parseCpuList(readSysfsFile(cpuDir + "/online"));
+  if (onlineCpus.isEmpty()) {
+    return;
+  }
+
+  QMap<int, int> numaNodes;
+  const QDir nodeDir(SYSFS_NODE_DIR);
+  for (const QString& nodeName : nodeDir.entryList(QStringList() << "node*", QDir::Dirs)) {
+    bool ok = false;
+    const int node = nodeName.mid(4).toInt(&ok);
+    if (!ok) {
+      continue;
+    }
+
+    for (int cpu : parseCpuList(readSysfsFile(nodeDir.filePath(nodeName + "/cpulist")))) {
+      numaNodes[cpu] = node;
+    }
+  }
+
+  // L3 domains are identified by the lowest CPU sharing the cache and renumbered densely afterwards.
+  QMap<int, int> l3DomainIds;
+  for (int cpu : onlineCpus) {
+    const QString cpuPath = QString("%1/cpu%2").arg(cpuDir).arg(cpu);
+    CpuInfo cpuInfo;
+    cpuInfo.cpu = cpu;
+    cpuInfo.core = readSysfsInt(cpuPath + "/topology/core_id", cpu);
+    cpuInfo.package = readSysfsInt(cpuPath + "/topology/physical_package_id", 0);
+    cpuInfo.numaNode = numaNodes.value(cpu, 0);
+    const QList<int> siblings = parseCpuList(readSysfsFile(cpuPath + "/topology/thread_siblings_list"));
+    cpuInfo.siblingIndex = std::max(siblings.indexOf(cpu), 0);
+
+    int l3Leader = -1;
+    const QDir cacheDir(cpuPath + "/cache");
+    for (const QString& indexName : cacheDir.entryList(QStringList() << "index*", QDir::Dirs)) {
+      const QString indexPath = cacheDir.filePath(indexName);
+      if (readSysfsInt(indexPath + "/level", 0) != 3) {
+        continue;
+      }
+
+      const QList<int> sharedCpus = parseCpuList(readSysfsFile(indexPath + "/shared_cpu_list"));
+      l3Leader = sharedCpus.isEmpty() ? cpu : *std::min_element(sharedCpus.begin(), sharedCpus.end());
+      if (m_l3CacheSize == 0) {
+        m_l3CacheSize = parseCacheSize(readSysfsFile(indexPath + "/size"));
+      }
+
+      break;
+    }
+
+    if (l3Leader == -1) {
+      l3Leader = cpuInfo.package;
+    }
+
+    if (!l3DomainIds.contains(l3Leader)) {
+      l3DomainIds.insert(l3Leader, l3DomainIds.size());
+    }
+
+    cpuInfo.l3Domain = l3DomainIds.value(l3Leader);
+    m_cpus.append(cpuInfo);
+  }
+
+  m_l3DomainCount = std::max(l3DomainIds.size(), 1);
+#endif
+}
+
+void CpuTopology::detectFallback() {
+  const int cpuCount = std::max(QThread::idealThreadCount(), 1);
+  for (int cpu = 0; cpu < cpuCount; ++cpu) {
+    m_cpus.append({cpu, cpu, 0, 0, 0, 0});
+  }
+
+  m_l3DomainCount = 1;
+}
+
+}
@@ -0,0 +1,58 @@
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#pragma once
+
+#include <QList>
+#include <QtGlobal>
+
+namespace WalletGUI {
+
+struct CpuInfo {
+  int cpu;
+  int core;
+  int package;
+  int numaNode;
+  int l3Domain;
+  int siblingIndex;
+};
+
+// CPU layout of the machine read from Linux sysfs: logical CPUs, SMT siblings, L3 cache domains and
+// NUMA nodes. On other platforms, or when sysfs is unavailable, every logical CPU is reported as a
+// separate core in a single L3 domain of unknown size.
+class CpuTopology {
+public:
+  static const CpuTopology& instance();
+
+  const QList<CpuInfo>& getCpus() const;
+  int getL3DomainCount() const;
+  quint64 getL3CacheSize() const;
+
+  // CPUs for _threadCount mining threads, skipping _excludedCpus. Whole cores are used before SMT
+  // siblings and consecutive threads are spread across L3 domains. Wraps around when there are more
+  // threads than usable CPUs; empty when every CPU is excluded or threads can't be pinned here.
+  QList<int> getPlacement(quint32 _threadCount, const QList<int>& _excludedCpus) const;
+
+  // Number of threads whose scratchpads (_bytesPerThread each) fit into the L3 caches of the usable
+  // CPUs, at most one per physical core.
+  quint32 getSuggestedThreadCount(quint64 _bytesPerThread, const QList<int>& _excludedCpus) const;
+
+  static bool isPinningSupported();
+  static bool pinCurrentThread(int _cpu);
+
+  // Moves the calling thread to SCHED_IDLE, or back to the normal policy, and sets its nice level.
+  // Raising the priority again usually needs CAP_SYS_NICE or a matching RLIMIT_NICE.
+  static bool setCurrentThreadPriority(bool _idle, int _niceLevel);
+
+private:
+  QList<CpuInfo> m_cpus;
+  int m_l3DomainCount;
+  quint64 m_l3CacheSize;
+
+  CpuTopology();
+
+  void detect();
+  void detectFallback();
+};
+
+}
@@ -0,0 +1,95 @@
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#include "crypto/hash.hpp"
+
+#include "CryptoNightKernel.h"
+
+namespace WalletGUI {
+
+namespace {
+
+// One specialization per algorithm the crypto library can hash. An algorithm without a
+// specialization is reported as unsupported.
+template<HashAlgorithm _algorithm>
+struct CryptoNightVariant {
+  static const bool SUPPORTED = false;
+
+  template<typename... Args>
+  static void hash(Args&&...) {
+    Q_UNREACHABLE();
+  }
+};
+
+template<>
+struct CryptoNightVariant<HashAlgorithm::CRYPTONIGHT_V1> {
+  static const bool SUPPORTED = true;
+
+  static void hash(crypto::CryptoNightContext& _context, const QByteArray& _blob, crypto::Hash& _hash) {
+    _hash = _context.cn_slow_hash_v1(_blob.constData(), _blob.size());
+  }
+};
+
+template<>
+struct CryptoNightVariant<HashAlgorithm::CRYPTONIGHT> {
+  static const bool SUPPORTED = true;
+
+  static void hash(crypto::CryptoNightContext& _context, const QByteArray& _blob, crypto::Hash& _hash) {
+    _hash = _context.cn_slow_hash(_blob.constData(), _blob.size());
+  }
+};
+
+}
+
+CryptoNightKernel::CryptoNightKernel(HashAlgorithm _algorithm) : m_algorithm(HashAlgorithm::CRYPTONIGHT_V1),
+  m_hashFunction(getHashFunction(HashAlgorithm::CRYPTONIGHT_V1)), m_context(new crypto::CryptoNightContext) {
+  setAlgorithm(_algorithm);
+}
+
+CryptoNightKernel::~CryptoNightKernel() {
+}
+
+bool CryptoNightKernel::isSupported(HashAlgorithm _algorithm) {
+  return getHashFunction(_algorithm) != nullptr;
+}
+
+HashAlgorithm CryptoNightKernel::getAlgorithm() const {
+  return m_algorithm;
+}
+
+bool CryptoNightKernel::setAlgorithm(HashAlgorithm _algorithm) {
+  HashFunction hashFunction = getHashFunction(_algorithm);
+  if (hashFunction == nullptr) {
+    return false;
+  }
+
+  m_algorithm = _algorithm;
+  m_hashFunction = hashFunction;
+  return true;
+}
+
+void CryptoNightKernel::hash(const QByteArray& _blob, crypto::Hash& _hash) {
+  (this->*m_hashFunction)(_blob, _hash);
+}
+
+CryptoNightKernel::HashFunction CryptoNightKernel::getHashFunction(HashAlgorithm _algorithm) {
+  switch (_algorithm) {
+  case HashAlgorithm::CRYPTONIGHT:
+    return CryptoNightVariant<HashAlgorithm::CRYPTONIGHT>::SUPPORTED ?
+      &CryptoNightKernel::hashBlob<HashAlgorithm::CRYPTONIGHT> : nullptr;
+  case HashAlgorithm::CRYPTONIGHT_V1:
+    return CryptoNightVariant<HashAlgorithm::CRYPTONIGHT_V1>::SUPPORTED ?
+      &CryptoNightKernel::hashBlob<HashAlgorithm::CRYPTONIGHT_V1> : nullptr;
+  case HashAlgorithm::UNKNOWN:
+    break;
+  }
+
+  return nullptr;
+}
+
+template<HashAlgorithm _algorithm>
+void CryptoNightKernel::hashBlob(const QByteArray& _blob, crypto::Hash& _hash) {
+  CryptoNightVariant<_algorithm>::hash(*m_context, _blob, _hash);
+}
+
+}
@@ -0,0 +1,55 @@
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#pragma once
+
+#include <QObject>
+
+#include <memory>
+
+#include "IMinerWorker.h"
+
+namespace crypto {
+  struct Hash;
+  class CryptoNightContext;
+}
+
+namespace WalletGUI {
+
+// Hashes one blob per call with a CryptoNight context and scratchpad owned by the kernel, so a
+// worker keeps its scratchpad between rounds. The crypto library only exposes a single-blob entry
+// point; hashing several nonces per call only pays off with a multi-way implementation that
+// interleaves the scratchpad loops, which the library does not have.
+//
+// Every algorithm variant is a specialization of a hash function templated on HashAlgorithm, so the
+// call into the crypto library is resolved at compile time. setAlgorithm() only swaps the function,
+// which the worker does when a job asks for a different algorithm.
+class CryptoNightKernel {
+  Q_DISABLE_COPY(CryptoNightKernel)
+
+public:
+  // Memory walked by one CryptoNight hash; every mining thread keeps one scratchpad of this size.
+  static const quint64 SCRATCHPAD_SIZE = 2 * 1024 * 1024;
+
+  explicit CryptoNightKernel(HashAlgorithm _algorithm = HashAlgorithm::CRYPTONIGHT_V1);
+  ~CryptoNightKernel();
+
+  static bool isSupported(HashAlgorithm _algorithm);
+
+  HashAlgorithm getAlgorithm() const;
+  // Returns false and keeps the current algorithm when this build cannot hash _algorithm.
+  bool setAlgorithm(HashAlgorithm _algorithm);
+  void hash(const QByteArray& _blob, crypto::Hash& _hash);
+
+private:
+  typedef void (CryptoNightKernel::*HashFunction)(const QByteArray& _blob, crypto::Hash& _hash);
+
+  HashAlgorithm m_algorithm;
+  HashFunction m_hashFunction;
+  std::unique_ptr<crypto::CryptoNightContext> m_context;
+
+  static HashFunction getHashFunction(HashAlgorithm _algorithm);
+  template<HashAlgorithm _algorithm> void hashBlob(const QByteArray& _blob, crypto::Hash& _hash);
+};
+
+}
@@ -0,0 +1,120 @@
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#include "HashAlgorithm.h"
+
+namespace WalletGUI {
+
+namespace {
+
+struct AlgorithmName {
+  const char* name;
+  HashAlgorithm algorithm;
+};
+
+// Names that pin a variant. The first name of every algorithm is the canonical one.
+const AlgorithmName ALGORITHM_NAMES[] = {
+  {"cn/1", HashAlgorithm::CRYPTONIGHT_V1},
+  {"cryptonight/1", HashAlgorithm::CRYPTONIGHT_V1},
+  {"cryptonight-v1", HashAlgorithm::CRYPTONIGHT_V1},
+  {"cn/0", HashAlgorithm::CRYPTONIGHT},
+  {"cryptonight/0", HashAlgorithm::CRYPTONIGHT}
+};
+
+// The algorithm family alone. Pools send it with a separate "variant", or leave the variant to the
+// blob version.
+const char* const ALGORITHM_FAMILY_NAMES[] = {"cryptonight", "cn"};
+
+const AlgorithmName VARIANT_NAMES[] = {
+  {"1", HashAlgorithm::CRYPTONIGHT_V1},
+  {"0", HashAlgorithm::CRYPTONIGHT}
+};
+
+struct BlobVersionAlgorithm {
+  quint8 minMajorVersion;
+  HashAlgorithm algorithm;
+};
+
+// Sorted by version; a blob uses the last row whose version it has reached.
+const BlobVersionAlgorithm BLOB_VERSION_ALGORITHMS[] = {
+  {0, HashAlgorithm::CRYPTONIGHT_V1}
+};
+
+const quint8 VARINT_CONTINUATION_BIT = 0x80;
+
+template<size_t _size>
+HashAlgorithm findAlgorithm(const AlgorithmName (&_names)[_size], const QString& _name) {
+  for (const AlgorithmName& entry : _names) {
+    if (_name.compare(QLatin1String(entry.name), Qt::CaseInsensitive) == 0) {
+      return entry.algorithm;
+    }
+  }
+
+  return HashAlgorithm::UNKNOWN;
+}
+
+bool isFamilyName(const QString& _name) {
+  for (const char* familyName : ALGORITHM_FAMILY_NAMES) {
+    if (_name.compare(QLatin1String(familyName), Qt::CaseInsensitive) == 0) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+}
+
+HashAlgorithm HashAlgorithmRegistry::fromName(const QString& _name) {
+  return findAlgorithm(ALGORITHM_NAMES, _name);
+}
+
+HashAlgorithm HashAlgorithmRegistry::fromVariant(const QString& _variant) {
+  return findAlgorithm(VARIANT_NAMES, _variant.trimmed());
+}
+
+HashAlgorithm HashAlgorithmRegistry::fromBlobVersion(quint8 _majorVersion) {
+  HashAlgorithm result = HashAlgorithm::UNKNOWN;
+  for (const BlobVersionAlgorithm& entry : BLOB_VERSION_ALGORITHMS) {
+    if (_majorVersion < entry.minMajorVersion) {
+      break;
+    }
+
+    result = entry.algorithm;
+  }
+
+  return result;
+}
+
+HashAlgorithm HashAlgorithmRegistry::fromJob(const QString& _name, const QString& _variant, const QByteArray& _blob) {
+  const HashAlgorithm namedAlgorithm = fromName(_name);
+  if (namedAlgorithm != HashAlgorithm::UNKNOWN) {
+    return namedAlgorithm;
+  }
+
+  if (_name.isEmpty() || isFamilyName(_name)) {
+    const HashAlgorithm variantAlgorithm = fromVariant(_variant);
+    if (variantAlgorithm != HashAlgorithm::UNKNOWN) {
+      return variantAlgorithm;
+    }
+  }
+
+  // The major version is a varint; every version in use fits into its first byte.
+  if (_blob.isEmpty() || (static_cast<quint8>(_blob[0]) & VARINT_CONTINUATION_BIT) != 0) {
+    return HashAlgorithm::UNKNOWN;
+  }
+
+  return fromBlobVersion(static_cast<quint8>(_blob[0]));
+}
+
+QString HashAlgorithmRegistry::getName(HashAlgorithm _algorithm) {
+  for (const AlgorithmName& entry : ALGORITHM_NAMES) {
+    if (entry.algorithm == _algorithm) {
+      return QString::fromLatin1(entry.name);
+    }
+  }
+
+  return QString("unknown");
+}
+
+}
@@ -0,0 +1,29 @@
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#pragma once
+
+#include <QByteArray>
+#include <QString>
+
+#include "IMinerWorker.h"
+
+namespace WalletGUI {
+
+// Maps what a Stratum job says about its proof of work to a HashAlgorithm: the name in the optional
+// "algo" field, the optional "variant" field, or else the major version that starts every block
+// hashing blob. A fork that changes the hash adds a row to the tables in HashAlgorithm.cpp and a kernel
+// variant in CryptoNightKernel.cpp.
+class HashAlgorithmRegistry {
+public:
+  // UNKNOWN for names that don't pin a variant, such as the bare "cryptonight".
+  static HashAlgorithm fromName(const QString& _name);
+  static HashAlgorithm fromVariant(const QString& _variant);
+  static HashAlgorithm fromBlobVersion(quint8 _majorVersion);
+  // A name with a variant wins. A bare family name, or no name, takes the variant field when it is
+  // known. Everything else, including names this build doesn't know, falls back to the blob version.
+  static HashAlgorithm fromJob(const QString& _name, const QString& _variant, const QByteArray& _blob);
+  static QString getName(HashAlgorithm _algorithm);
+};
+
+}
@@ -0,0 +1,48 @@
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#pragma once
+
+#include <QtGlobal>
+
+#include <atomic>
+
+namespace WalletGUI {
+
+// Monotonic hash counts of a single worker. Only the owning worker thread writes, so an increment is
+// a relaxed load/store pair instead of a locked read-modify-write, and readers sum the counters of all
+// workers. The padding keeps counters of different workers on separate cache lines even when the
+// allocator does not honour over-aligned types.
+class HashCounter {
+  Q_DISABLE_COPY(HashCounter)
+
+public:
+  HashCounter() : m_mainHashCount(0), m_alternateHashCount(0) {
+  }
+
+  void addMainHashes(quint32 _count) {
+    m_mainHashCount.store(m_mainHashCount.load(std::memory_order_relaxed) + _count, std::memory_order_relaxed);
+  }
+
+  void addAlternateHashes(quint32 _count) {
+    m_alternateHashCount.store(m_alternateHashCount.load(std::memory_order_relaxed) + _count, std::memory_order_relaxed);
+  }
+
+  quint64 getMainHashCount() const {
+    return m_mainHashCount.load(std::memory_order_relaxed);
+  }
+
+  quint64 getAlternateHashCount() const {
+    return m_alternateHashCount.load(std::memory_order_relaxed);
+  }
+
+private:
+  static const size_t CACHE_LINE_SIZE = 64;
+
+  char m_leadingPadding[CACHE_LINE_SIZE];
+  std::atomic<quint64> m_mainHashCount;
+  std::atomic<quint64> m_alternateHashCount;
+  char m_trailingPadding[CACHE_LINE_SIZE - 2 * sizeof(std::atomic<quint64>)];
+};
+
+}
@@ -0,0 +1,83 @@
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#include <cmath>
+
+#include "HashRateStatistics.h"
+
+namespace WalletGUI {
+
+namespace {
+
+const int MAX_WINDOW_SECONDS = 15 * 60;
+const double EWMA_TIME_CONSTANT_MSECS = 30 * 1000;
+
+int getWindowSeconds(HashRateWindow _window) {
+  switch (_window) {
+  case HashRateWindow::SECONDS_10:
+    return 10;
+  case HashRateWindow::SECONDS_60:
+    return 60;
+  case HashRateWindow::MINUTES_15:
+    return MAX_WINDOW_SECONDS;
+  }
+
+  return 10;
+}
+
+}
+
+HashRateStatistics::HashRateStatistics() : m_samples(MAX_WINDOW_SECONDS + 1), m_head(-1), m_sampleCount(0),
+  m_ewmaHashRate(0) {
+}
+
+void HashRateStatistics::reset() {
+  m_head = -1;
+  m_sampleCount = 0;
+  m_ewmaHashRate = 0;
+}
+
+void HashRateStatistics::addSample(qint64 _timestamp, quint64 _hashCount) {
+  if (m_sampleCount > 0) {
+    const Sample& previous = m_samples[m_head];
+    const qint64 interval = _timestamp - previous.timestamp;
+    if (interval <= 0) {
+      return;
+    }
+
+    const double hashRate = (_hashCount - previous.hashCount) * 1000.0 / interval;
+    if (m_sampleCount == 1) {
+      m_ewmaHashRate = hashRate;
+    } else {
+      const double alpha = 1 - std::exp(-interval / EWMA_TIME_CONSTANT_MSECS);
+      m_ewmaHashRate += alpha * (hashRate - m_ewmaHashRate);
+    }
+  }
+
+  m_head = (m_head + 1) % m_samples.size();
+  m_samples[m_head] = {_timestamp, _hashCount};
+  m_sampleCount = qMin(m_sampleCount + 1, m_samples.size());
+}
+
+double HashRateStatistics::getHashRate(HashRateWindow _window) const {
+  // Samples are one second apart, so the window start is found by index. Until the window has filled
+  // up, the rate covers the history collected so far.
+  const int distance = qMin(getWindowSeconds(_window), m_sampleCount - 1);
+  if (distance <= 0) {
+    return 0;
+  }
+
+  const Sample& last = m_samples[m_head];
+  const Sample& first = m_samples[(m_head - distance + m_samples.size()) % m_samples.size()];
+  if (last.timestamp <= first.timestamp) {
+    return 0;
+  }
+
+  return (last.hashCount - first.hashCount) * 1000.0 / (last.timestamp - first.timestamp);
+}
+
+double HashRateStatistics::getEwmaHashRate() const {
+  return m_ewmaHashRate;
+}
+
+}
@@ -0,0 +1,36 @@
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#pragma once
+
+#include <QVector>
+
+#include "IPoolMiner.h"
+
+namespace WalletGUI {
+
+// Hash rate derived from periodic samples of a monotonic hash count. Keeps one sample per second for
+// the longest window and an exponentially weighted moving average on top of them.
+class HashRateStatistics {
+public:
+  HashRateStatistics();
+
+  void reset();
+  void addSample(qint64 _timestamp, quint64 _hashCount);
+
+  double getHashRate(HashRateWindow _window) const;
+  double getEwmaHashRate() const;
+
+private:
+  struct Sample {
+    qint64 timestamp;
+    quint64 hashCount;
+  };
+
+  QVector<Sample> m_samples;
+  int m_head;
+  int m_sampleCount;
+  double m_ewmaHashRate;
+};
+
+}
@@ -0,0 +1,43 @@
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#include "JobSlot.h"
+
+namespace WalletGUI {
+
+JobSlot::JobSlot() : m_job(), m_generation(0), m_hasJob(false) {
+}
+
+JobSlot::~JobSlot() {
+}
+
+// Every snapshot gets its own nonce counter, so a worker still hashing the previous job keeps
+// reserving from that job's counter and never takes nonces of the new one.
+void JobSlot::publish(const Job& _job) {
+  std::shared_ptr<Job> job = std::make_shared<Job>(_job);
+  job->generation = m_generation.load(std::memory_order_relaxed) + 1;
+  job->nonce = std::make_shared<std::atomic<quint32>>(0);
+  std::atomic_store_explicit(&m_job, std::shared_ptr<const Job>(std::move(job)), std::memory_order_release);
+  m_hasJob.store(true, std::memory_order_relaxed);
+  m_generation.fetch_add(1, std::memory_order_release);
+}
+
+void JobSlot::clear() {
+  std::atomic_store_explicit(&m_job, std::shared_ptr<const Job>(), std::memory_order_release);
+  m_hasJob.store(false, std::memory_order_relaxed);
+  m_generation.fetch_add(1, std::memory_order_release);
+}
+
+quint64 JobSlot::getGeneration() const {
+  return m_generation.load(std::memory_order_acquire);
+}
+
+bool JobSlot::hasJob() const {
+  return m_hasJob.load(std::memory_order_relaxed);
+}
+
+std::shared_ptr<const Job> JobSlot::getJob() const {
+  return std::atomic_load_explicit(&m_job, std::memory_order_acquire);
+}
+
+}
@@ -0,0 +1,41 @@
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#pragma once
+
+#include <QObject>
+
+#include <atomic>
+#include <memory>
+
+#include "IMinerWorker.h"
+
+namespace WalletGUI {
+
+// Single-writer publication point for the current mining job.
+//
+// The pool client publishes immutable Job snapshots, each with a fresh nonce counter, and every
+// publish or clear bumps the generation counter after the snapshot is visible. Workers poll the
+// generation with a single atomic load and fetch the snapshot only when it has changed, so the
+// hashing loop never takes a lock or compares job ids.
+class JobSlot {
+  Q_DISABLE_COPY(JobSlot)
+
+public:
+  JobSlot();
+  ~JobSlot();
+
+  void publish(const Job& _job);
+  void clear();
+
+  quint64 getGeneration() const;
+  bool hasJob() const;
+  std::shared_ptr<const Job> getJob() const;
+
+private:
+  std::shared_ptr<const Job> m_job;
+  std::atomic<quint64> m_generation;
+  std::atomic<bool> m_hasJob;
+};
+
+}
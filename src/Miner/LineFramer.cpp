@@ -0,0 +1,81 @@
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#include <QIODevice>
+
+#include <cstring>
+
+#include "LineFramer.h"
+
+namespace WalletGUI {
+
+LineFramer::LineFramer(int _maxLineSize) : m_readOffset(0), m_scanOffset(0), m_maxLineSize(_maxLineSize) {
+}
+
+bool LineFramer::readFrom(QIODevice* _device) {
+  compact();
+  const qint64 available = _device->bytesAvailable();
+  if (available > 0) {
+    const int oldSize = m_buffer.size();
+    m_buffer.resize(oldSize + static_cast<int>(available));
+    const qint64 readSize = _device->read(m_buffer.data() + oldSize, available);
+    m_buffer.resize(oldSize + static_cast<int>(qMax<qint64>(readSize, 0)));
+  }
+
+  return !isOverflowed();
+}
+
+bool LineFramer::append(const char* _data, int _size) {
+  compact();
+  m_buffer.append(_data, _size);
+  return !isOverflowed();
+}
+
+bool LineFramer::nextLine(const char*& _line, int& _size) {
+  for (;;) {
+    const char* begin = m_buffer.constData() + m_readOffset;
+    const char* scanBegin = m_buffer.constData() + m_scanOffset;
+    const char* newLine = static_cast<const char*>(std::memchr(scanBegin, '\n', m_buffer.size() - m_scanOffset));
+    if (newLine == nullptr) {
+      // Remember how far the partial line has been scanned so that it is not searched again.
+      m_scanOffset = m_buffer.size();
+      return false;
+    }
+
+    const char* end = newLine;
+    if (end > begin && *(end - 1) == '\r') {
+      --end;
+    }
+
+    m_readOffset = static_cast<int>(newLine - m_buffer.constData()) + 1;
+    m_scanOffset = m_readOffset;
+    if (end > begin) {
+      _line = begin;
+      _size = static_cast<int>(end - begin);
+      return true;
+    }
+  }
+}
+
+void LineFramer::clear() {
+  m_buffer.clear();
+  m_readOffset = 0;
+  m_scanOffset = 0;
+}
+
+void LineFramer::compact() {
+  if (m_readOffset == 0) {
+    return;
+  }
+
+  m_buffer.remove(0, m_readOffset);
+  m_scanOffset -= m_readOffset;
+  m_readOffset = 0;
+}
+
+bool LineFramer::isOverflowed() const {
+  return m_buffer.size() - m_readOffset > m_maxLineSize &&
+    std::memchr(m_buffer.constData() + m_scanOffset, '\n', m_buffer.size() - m_scanOffset) == nullptr;
+}
+
+}
@@ -0,0 +1,36 @@
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#pragma once
+
+#include <QByteArray>
+
+class QIODevice;
+
+namespace WalletGUI {
+
+// Splits a byte stream into '\n' terminated lines. Bytes are read straight into one buffer and lines
+// are handed out as pointers into it, valid until the next readFrom()/append(). A partial line stays
+// buffered until its terminator arrives.
+class LineFramer {
+public:
+  explicit LineFramer(int _maxLineSize);
+
+  // Both return false when the pending partial line grows beyond the maximum line size.
+  bool readFrom(QIODevice* _device);
+  bool append(const char* _data, int _size);
+
+  bool nextLine(const char*& _line, int& _size);
+  void clear();
+
+private:
+  QByteArray m_buffer;
+  int m_readOffset;
+  int m_scanOffset;
+  const int m_maxLineSize;
+
+  void compact();
+  bool isOverflowed() const;
+};
+
+}
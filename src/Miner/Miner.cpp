@@ -1,263 +1,517 @@
-// Copyright (c) 2015-2018, The Bytecoin developers.
-// Licensed under the GNU Lesser General Public License. See LICENSE for details.
-
-#include <QThread>
-#include <QTimerEvent>
-
-#include "Miner.h"
-#include "StratumClient.h"
-#include "Worker.h"
-
-namespace WalletGUI {
-
-namespace {
-
-const int HASHRATE_TIMER_INTERVAL = 1000;
-
-}
-
-Miner::Miner(const QString& _host, quint16 _port, quint32 _difficulty, const QString& _login,
-  const QString& _password, QObject* _parent) : QObject(_parent), m_minerState(STATE_STOPPED),
-  m_mainJob(), m_alternateJob(), m_mainJobLock(), m_alternateJobLock(), m_alternateStratumClient(nullptr),
-  m_mainNonce(0), m_alternateNonce(0), m_hashCounter(0), m_alternameHashCounter(0), m_alternateProbability(0),
-  m_hashCountPerSecond(0), m_alternateHashCountPerSecond(0), m_hashRateTimerId(-1) {
-  m_mainStratumClient = new StratumClient(m_mainJob, m_mainJobLock, m_mainNonce, _host, _port, _difficulty, _login, _password, this);
-  m_mainStratumClient->addObserver(this);
-}
-
-Miner::~Miner() {
-  if (m_minerState != STATE_STOPPED) {
-    stop();
-  }
-}
-
-void Miner::start(quint32 _coreCount) {
-  Q_ASSERT(m_minerState == STATE_STOPPED);
-  m_mainStratumClient->start();
-  if (m_alternateStratumClient != nullptr) {
-    m_alternateStratumClient->start();
-  }
-
-  if (m_hashRateTimerId == -1) {
-    m_hashRateTimerId = startTimer(HASHRATE_TIMER_INTERVAL);
-  }
-
-  for (quint32 i = 0; i < _coreCount; ++i) {
-    if ((quint32)m_workerThreadList.size() < i + 1) {
-      Worker* worker = new Worker(m_mainJob, m_alternateJob, m_mainJobLock, m_alternateJobLock,
-        m_mainNonce, m_alternateNonce, m_alternateProbability, m_hashCounter, m_alternameHashCounter, nullptr);
-      worker->addObserver(m_mainStratumClient);
-      if (m_alternateStratumClient != nullptr) {
-        worker->addAlternateObserver(m_alternateStratumClient);
-      }
-
-      QThread* thread = new QThread(this);
-      connect(thread, &QThread::started, worker, &Worker::start);
-      worker->moveToThread(thread);
-      m_workerThreadList.append(qMakePair(thread, worker));
-    }
-
-    m_workerThreadList[i].first->start();
-  }
-}
-
-void Miner::stop() {
-  Q_ASSERT(m_minerState != STATE_STOPPED);
-  m_mainStratumClient->stop();
-  if (m_alternateStratumClient != nullptr) {
-    m_alternateStratumClient->stop();
-  }
-
-  if (m_hashRateTimerId != -1) {
-    killTimer(m_hashRateTimerId);
-    m_hashRateTimerId = -1;
-  }
-
-  m_hashCountPerSecond = 0;
-  m_alternateHashCountPerSecond = 0;
-  for (auto& workerThread : m_workerThreadList) {
-    workerThread.second->stop();
-    workerThread.first->quit();
-  }
-
-  for (auto& workerThread : m_workerThreadList) {
-    if (workerThread.first->isRunning()) {
-      workerThread.first->wait();
-    }
-  }
-}
-
-Miner::State Miner::getCurrentState() const {
-  return m_minerState;
-}
-
-QString Miner::getPoolHost() const {
-  return m_mainStratumClient->getPoolHost();
-}
-
-quint16 Miner::getPoolPort() const {
-  return m_mainStratumClient->getPoolPort();
-}
-
-quint32 Miner::getDifficulty() const {
-  return m_mainStratumClient->getDifficulty();
-}
-
-quint32 Miner::getHashRate() const {
-  return m_hashCountPerSecond;
-}
-
-quint32 Miner::getAlternateHashRate() const {
-  return m_alternateHashCountPerSecond;
-}
-
-quint32 Miner::getGoodShareCount() const {
-  return m_mainStratumClient->getGoodShareCount();
-}
-
-quint32 Miner::getGoodAlternateShareCount() const {
-  if (m_alternateStratumClient != nullptr) {
-    return m_alternateStratumClient->getGoodShareCount();
-  }
-
-  return 0;
-}
-
-quint32 Miner::getBadShareCount() const {
-  return m_mainStratumClient->getBadShareCount();
-}
-
-quint32 Miner::getConnectionErrorCount() const {
-  return m_mainStratumClient->getConnectionErrorCount();
-}
-
-QDateTime Miner::getLastConnectionErrorTime() const {
-  return m_mainStratumClient->getLastConnectionErrorTime();
-}
-
-void Miner::setAlternateAccount(const QString& _login, quint32 _probability) {
-  if (m_alternateStratumClient != nullptr) {
-    if (m_alternateStratumClient->getLogin() == _login && m_alternateProbability == _probability) {
-      return;
-    }
-
-    if (m_alternateStratumClient->getLogin() == _login) {
-      m_alternateProbability = _probability;
-      return;
-    }
-
-    m_alternateStratumClient->stop();
-    m_alternateStratumClient->deleteLater();
-  }
-
-  m_alternateProbability = _probability;
-  m_alternateStratumClient = new StratumClient(m_alternateJob, m_alternateJobLock, m_alternateNonce,
-    m_mainStratumClient->getPoolHost(), m_mainStratumClient->getPoolPort(), m_mainStratumClient->getDifficulty(), _login, "x", this);
-  connect(m_alternateStratumClient, &StratumClient::goodShareCountChangedSignal, this, &Miner::goodAlternateShareCountChangedSignal);
-  if (m_minerState != STATE_STOPPED) {
-    m_alternateStratumClient->start();
-  }
-
-  for (auto& workerThread : m_workerThreadList) {
-    workerThread.second->addAlternateObserver(m_alternateStratumClient);
-  }
-}
-
-void Miner::unsetAlternateAccount() {
-  if (m_alternateStratumClient == nullptr) {
-    return;
-  }
-
-  for (auto& workerThread : m_workerThreadList) {
-    workerThread.second->removeAlternateObserver(m_alternateStratumClient);
-  }
-
-  if (m_minerState != STATE_STOPPED) {
-    m_alternateStratumClient->stop();
-  }
-
-  m_alternateStratumClient->deleteLater();
-  m_alternateStratumClient = nullptr;
-  m_alternateProbability = 0;
-}
-
-void Miner::addObserver(IPoolMinerObserver* _observer) {
-  QObject* observer = dynamic_cast<QObject*>(_observer);
-  m_observerConnections[_observer] << connect(this, SIGNAL(stateChangedSignal(int)), observer, SLOT(stateChanged(int)));
-  m_observerConnections[_observer] << connect(this, SIGNAL(hashRateChangedSignal(quint32)), observer, SLOT(hashRateChanged(quint32)));
-  m_observerConnections[_observer] << connect(this, SIGNAL(alternateHashRateChangedSignal(quint32)), observer, SLOT(alternateHashRateChanged(quint32)));
-  m_observerConnections[_observer] << connect(this, SIGNAL(difficultyChangedSignal(quint32)), observer, SLOT(difficultyChanged(quint32)));
-  m_observerConnections[_observer] << connect(this, SIGNAL(goodShareCountChangedSignal(quint32)), observer, SLOT(goodShareCountChanged(quint32)));
-  m_observerConnections[_observer] << connect(this, SIGNAL(goodAlternateShareCountChangedSignal(quint32)), observer, SLOT(goodAlternateShareCountChanged(quint32)));
-  m_observerConnections[_observer] << connect(this, SIGNAL(badShareCountChangedSignal(quint32)), observer, SLOT(badShareCountChanged(quint32)));
-  m_observerConnections[_observer] << connect(this, SIGNAL(connectionErrorCountChangedSignal(quint32)), observer, SLOT(connectionErrorCountChanged(quint32)));
-  m_observerConnections[_observer] << connect(this, SIGNAL(lastConnectionErrorTimeChangedSignal(QDateTime)), observer, SLOT(lastConnectionErrorTimeChanged(QDateTime)));
-}
-
-void Miner::removeObserver(IPoolMinerObserver* _observer) {
-  if (!m_observerConnections.contains(_observer) || m_observerConnections.value(_observer).isEmpty()) {
-    return;
-  }
-
-  for (const auto& connection : m_observerConnections[_observer]) {
-    disconnect(connection);
-  }
-
-  m_observerConnections[_observer].clear();
-}
-
-void Miner::started() {
-  setState(STATE_RUNNING);
-}
-
-void Miner::stopped() {
-  setState(STATE_STOPPED);
-}
-
-void Miner::socketError() {
-  setState(STATE_ERROR);
-  m_hashCountPerSecond = 0;
-}
-
-void Miner::difficultyChanged(quint32 _difficulty) {
-  Q_EMIT difficultyChangedSignal(_difficulty);
-}
-
-void Miner::goodShareCountChanged(quint32 _goodShareCount) {
-  Q_EMIT goodShareCountChangedSignal(_goodShareCount);
-}
-
-void Miner::badShareCountChanged(quint32 _badShareCount) {
-  Q_EMIT badShareCountChangedSignal(_badShareCount);
-}
-
-void Miner::connectionErrorCountChanged(quint32 _connectionErrorCount) {
-  Q_EMIT connectionErrorCountChangedSignal(_connectionErrorCount);
-}
-
-void Miner::lastConnectionErrorTimeChanged(const QDateTime& _lastConnectionErrorTime) {
-  Q_EMIT lastConnectionErrorTimeChangedSignal(_lastConnectionErrorTime);
-}
-
-void Miner::timerEvent(QTimerEvent* _event) {
-  if (_event->timerId() == m_hashRateTimerId) {
-    m_hashCountPerSecond = m_hashCounter;
-    m_alternateHashCountPerSecond = m_alternameHashCounter;
-    m_hashCounter = 0;
-    m_alternameHashCounter = 0;
-    Q_EMIT hashRateChangedSignal(m_hashCountPerSecond);
-    Q_EMIT alternateHashRateChangedSignal(m_alternateHashCountPerSecond);
-    return;
-  }
-
-  QObject::timerEvent(_event);
-}
-
-void Miner::setState(State _newState) {
-  if (m_minerState != _newState) {
-    m_minerState = _newState;
-    Q_EMIT stateChangedSignal(m_minerState);
-  }
-}
-
-}
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#include <QTimer>
+#include <QTimerEvent>
+
+#include "Miner.h"
+#include "StratumClient.h"
+#include "WorkerPool.h"
+#include "logger.h"
+
+namespace WalletGUI {
+
+namespace {
+
+const int HASHRATE_TIMER_INTERVAL = 1000;
+const int PROBE_TIMEOUT = 15000;
+const double LATENCY_SMOOTHING_FACTOR = 0.3;
+const double NANOSECONDS_PER_MILLISECOND = 1e6;
+const double SECONDS_PER_MINUTE = 60;
+// The 60 second hash rate window has to be full before the first estimate, and a new login throws
+// away the current job, so the difficulty is not changed more often than every few minutes.
+const qint64 AUTO_DIFFICULTY_WARMUP = 60000;
+const qint64 MIN_AUTO_DIFFICULTY_INTERVAL = 300000;
+const qint64 MIN_AUTO_DIFFICULTY = 100;
+const qint64 MAX_AUTO_DIFFICULTY = 0xffffffff;
+
+}
+
+Miner::Miner(WorkerPool& _workerPool, const QString& _host, quint16 _port, quint32 _difficulty, const QString& _login,
+  const QString& _password, QObject* _parent) : QObject(_parent), m_workerPool(_workerPool), m_minerState(STATE_STOPPED),
+  m_mainJobSlot(), m_alternateJobSlot(), m_mainShareQueue(), m_alternateShareQueue(),
+  m_alternateStratumClient(nullptr), m_alternateProbability(0),
+  m_workSource({&m_mainJobSlot, &m_alternateJobSlot, &m_mainShareQueue, &m_alternateShareQueue, &m_alternateProbability}),
+  m_hashCount(0), m_alternateHashCount(0), m_hashRateTimerId(-1),
+  m_probeState(PROBE_IDLE), m_probeTimerId(-1), m_latencyMeasured(false), m_connectTime(0), m_loginTime(0), m_failedProbeCount(0),
+  m_standby(false), m_targetSharesPerMinute(0), m_difficultyDriftThreshold(0), m_difficultyUpdateClock() {
+  m_mainStratumClient = new StratumClient(m_mainJobSlot, m_mainShareQueue, _host, _port, _difficulty, _login, _password, this);
+  m_mainStratumClient->addObserver(this);
+}
+
+Miner::~Miner() {
+  cancelProbe();
+  stopStandby();
+  if (m_minerState != STATE_STOPPED) {
+    stop();
+  }
+}
+
+void Miner::start() {
+  Q_ASSERT(m_minerState == STATE_STOPPED);
+  cancelProbe();
+  // A standby session that is logged in already has a job; anything else starts from scratch.
+  const bool standbyReady = isStandbyReady();
+  if (!standbyReady) {
+    stopStandby();
+    m_mainStratumClient->start();
+  }
+
+  m_standby = false;
+  if (m_alternateStratumClient != nullptr) {
+    m_alternateStratumClient->start();
+  }
+
+  if (m_hashRateTimerId == -1) {
+    m_hashRateTimerId = startTimer(HASHRATE_TIMER_INTERVAL);
+  }
+
+  m_workerPool.attach(m_workSource);
+  resetHashRateStatistics();
+  if (standbyReady) {
+    setState(STATE_RUNNING);
+  }
+}
+
+void Miner::stop() {
+  Q_ASSERT(m_minerState != STATE_STOPPED);
+  m_mainStratumClient->stop();
+  if (m_alternateStratumClient != nullptr) {
+    m_alternateStratumClient->stop();
+  }
+
+  if (m_hashRateTimerId != -1) {
+    killTimer(m_hashRateTimerId);
+    m_hashRateTimerId = -1;
+  }
+
+  m_workerPool.detach(m_workSource);
+  resetHashRateStatistics();
+}
+
+void Miner::probe() {
+  if (m_minerState != STATE_STOPPED || m_probeState != PROBE_IDLE || m_standby) {
+    return;
+  }
+
+  m_probeState = PROBE_RUNNING;
+  m_probeTimerId = startTimer(PROBE_TIMEOUT);
+  m_mainStratumClient->start();
+}
+
+void Miner::cancelProbe() {
+  if (m_probeState == PROBE_IDLE) {
+    return;
+  }
+
+  if (m_probeTimerId != -1) {
+    killTimer(m_probeTimerId);
+    m_probeTimerId = -1;
+  }
+
+  // Probes are cancelled from the GUI thread for every pool at once, so they must not wait for a
+  // graceful disconnect.
+  m_probeState = PROBE_IDLE;
+  m_mainStratumClient->abort();
+}
+
+bool Miner::isProbing() const {
+  return m_probeState == PROBE_RUNNING;
+}
+
+PoolLatency Miner::getPoolLatency() const {
+  PoolLatency result;
+  result.isMeasured = m_latencyMeasured;
+  result.connectTime = m_connectTime;
+  result.loginTime = m_loginTime;
+  const LatencyHistogram& submitLatency = m_mainStratumClient->getSubmitLatencyHistogram();
+  result.submitTime = submitLatency.getCount() > 0 ? submitLatency.getSum() / submitLatency.getCount() : 0;
+  const quint32 goodShareCount = m_mainStratumClient->getGoodShareCount();
+  const quint32 badShareCount = m_mainStratumClient->getBadShareCount();
+  result.rejectRate = goodShareCount + badShareCount > 0 ? static_cast<double>(badShareCount) / (goodShareCount + badShareCount) : 0;
+  result.failedProbeCount = m_failedProbeCount;
+  return result;
+}
+
+void Miner::startStandby() {
+  if (m_minerState != STATE_STOPPED || m_standby) {
+    return;
+  }
+
+  cancelProbe();
+  m_standby = true;
+  m_mainStratumClient->start();
+}
+
+void Miner::stopStandby() {
+  if (!m_standby) {
+    return;
+  }
+
+  // A standby session has nothing in flight worth a graceful close, and stop() would spin a nested
+  // event loop under whoever demoted the pool.
+  m_standby = false;
+  m_mainStratumClient->abort();
+}
+
+bool Miner::isStandby() const {
+  return m_standby;
+}
+
+bool Miner::isStandbyReady() const {
+  return m_standby && m_mainStratumClient->isLoggedIn();
+}
+
+Miner::State Miner::getCurrentState() const {
+  return m_minerState;
+}
+
+QString Miner::getPoolHost() const {
+  return m_mainStratumClient->getPoolHost();
+}
+
+quint16 Miner::getPoolPort() const {
+  return m_mainStratumClient->getPoolPort();
+}
+
+quint32 Miner::getDifficulty() const {
+  return m_mainStratumClient->getDifficulty();
+}
+
+quint32 Miner::getHashRate() const {
+  return qRound(m_hashRateStatistics.getHashRate(HashRateWindow::SECONDS_10));
+}
+
+quint32 Miner::getAlternateHashRate() const {
+  return qRound(m_alternateHashRateStatistics.getHashRate(HashRateWindow::SECONDS_10));
+}
+
+quint32 Miner::getAlternateProbability() const {
+  return m_alternateProbability;
+}
+
+// Fraction of all hashes computed over the window that went to the alternate account, i.e. the
+// split the workers actually achieved as opposed to the configured percentage.
+double Miner::getAlternateHashShare(HashRateWindow _window) const {
+  const double alternateHashRate = m_alternateHashRateStatistics.getHashRate(_window);
+  const double totalHashRate = m_hashRateStatistics.getHashRate(_window) + alternateHashRate;
+  return totalHashRate > 0 ? alternateHashRate / totalHashRate : 0.0;
+}
+
+double Miner::getAverageHashRate(HashRateWindow _window) const {
+  return m_hashRateStatistics.getHashRate(_window);
+}
+
+double Miner::getEwmaHashRate() const {
+  return m_hashRateStatistics.getEwmaHashRate();
+}
+
+QList<double> Miner::getWorkerHashRates() const {
+  QList<double> result;
+  if (!m_workerPool.isAttached(m_workSource)) {
+    return result;
+  }
+
+  const quint32 workerCount = m_workerPool.getActiveWorkerCount();
+  for (quint32 i = 0; i < workerCount && i < static_cast<quint32>(m_workerHashRateStatistics.size()); ++i) {
+    result.append(m_workerHashRateStatistics[i].getHashRate(HashRateWindow::SECONDS_10));
+  }
+
+  return result;
+}
+
+quint32 Miner::getGoodShareCount() const {
+  return m_mainStratumClient->getGoodShareCount();
+}
+
+quint32 Miner::getGoodAlternateShareCount() const {
+  if (m_alternateStratumClient != nullptr) {
+    return m_alternateStratumClient->getGoodShareCount();
+  }
+
+  return 0;
+}
+
+quint32 Miner::getBadShareCount() const {
+  return m_mainStratumClient->getBadShareCount();
+}
+
+quint32 Miner::getStaleShareCount() const {
+  return m_mainStratumClient->getStaleShareCount();
+}
+
+double Miner::getSubmitLatency(double _fraction) const {
+  return m_mainStratumClient->getSubmitLatencyHistogram().getPercentile(_fraction);
+}
+
+const LatencyHistogram& Miner::getSubmitLatencyHistogram() const {
+  return m_mainStratumClient->getSubmitLatencyHistogram();
+}
+
+quint32 Miner::getConnectionErrorCount() const {
+  return m_mainStratumClient->getConnectionErrorCount();
+}
+
+QDateTime Miner::getLastConnectionErrorTime() const {
+  return m_mainStratumClient->getLastConnectionErrorTime();
+}
+
+void Miner::setAlternateAccount(const QString& _login, quint32 _probability) {
+  if (m_alternateStratumClient != nullptr) {
+    if (m_alternateStratumClient->getLogin() == _login && m_alternateProbability == _probability) {
+      return;
+    }
+
+    if (m_alternateStratumClient->getLogin() == _login) {
+      m_alternateProbability = _probability;
+      return;
+    }
+
+    m_alternateStratumClient->stop();
+    disconnect(&m_alternateShareQueue, nullptr, m_alternateStratumClient, nullptr);
+    m_alternateStratumClient->deleteLater();
+  }
+
+  m_alternateProbability = _probability;
+  m_alternateStratumClient = new StratumClient(m_alternateJobSlot, m_alternateShareQueue, m_mainStratumClient->getPoolHost(), m_mainStratumClient->getPoolPort(), m_mainStratumClient->getDifficulty(), _login, "x", this);
+  connect(m_alternateStratumClient, &StratumClient::goodShareCountChangedSignal, this, &Miner::goodAlternateShareCountChangedSignal);
+  if (m_minerState != STATE_STOPPED) {
+    m_alternateStratumClient->start();
+  }
+}
+
+void Miner::unsetAlternateAccount() {
+  if (m_alternateStratumClient == nullptr) {
+    return;
+  }
+
+  if (m_minerState != STATE_STOPPED) {
+    m_alternateStratumClient->stop();
+  }
+
+  disconnect(&m_alternateShareQueue, nullptr, m_alternateStratumClient, nullptr);
+  m_alternateStratumClient->deleteLater();
+  m_alternateStratumClient = nullptr;
+  m_alternateProbability = 0;
+}
+
+void Miner::setAutoDifficulty(quint32 _sharesPerMinute, quint32 _driftThreshold) {
+  m_targetSharesPerMinute = _sharesPerMinute;
+  m_difficultyDriftThreshold = _driftThreshold;
+}
+
+void Miner::addObserver(IPoolMinerObserver* _observer) {
+  QObject* observer = dynamic_cast<QObject*>(_observer);
+  m_observerConnections[_observer] << connect(this, SIGNAL(stateChangedSignal(int)), observer, SLOT(stateChanged(int)));
+  m_observerConnections[_observer] << connect(this, SIGNAL(hashRateChangedSignal(quint32)), observer, SLOT(hashRateChanged(quint32)));
+  m_observerConnections[_observer] << connect(this, SIGNAL(alternateHashRateChangedSignal(quint32)), observer, SLOT(alternateHashRateChanged(quint32)));
+  m_observerConnections[_observer] << connect(this, SIGNAL(difficultyChangedSignal(quint32)), observer, SLOT(difficultyChanged(quint32)));
+  m_observerConnections[_observer] << connect(this, SIGNAL(goodShareCountChangedSignal(quint32)), observer, SLOT(goodShareCountChanged(quint32)));
+  m_observerConnections[_observer] << connect(this, SIGNAL(goodAlternateShareCountChangedSignal(quint32)), observer, SLOT(goodAlternateShareCountChanged(quint32)));
+  m_observerConnections[_observer] << connect(this, SIGNAL(badShareCountChangedSignal(quint32)), observer, SLOT(badShareCountChanged(quint32)));
+  m_observerConnections[_observer] << connect(this, SIGNAL(staleShareCountChangedSignal(quint32)), observer, SLOT(staleShareCountChanged(quint32)));
+  m_observerConnections[_observer] << connect(this, SIGNAL(connectionErrorCountChangedSignal(quint32)), observer, SLOT(connectionErrorCountChanged(quint32)));
+  m_observerConnections[_observer] << connect(this, SIGNAL(lastConnectionErrorTimeChangedSignal(QDateTime)), observer, SLOT(lastConnectionErrorTimeChanged(QDateTime)));
+}
+
+void Miner::removeObserver(IPoolMinerObserver* _observer) {
+  if (!m_observerConnections.contains(_observer) || m_observerConnections.value(_observer).isEmpty()) {
+    return;
+  }
+
+  for (const auto& connection : m_observerConnections[_observer]) {
+    disconnect(connection);
+  }
+
+  m_observerConnections[_observer].clear();
+}
+
+void Miner::started() {
+  if (m_probeState == PROBE_FINISHED) {
+    return;
+  }
+
+  updateLatency();
+  if (m_probeState == PROBE_RUNNING) {
+    finishProbe(true);
+    return;
+  } else if (m_standby) {
+    return;
+  }
+
+  // A miner that recovers from an error takes the workers back from the pool that stood in for it.
+  m_workerPool.attach(m_workSource);
+  setState(STATE_RUNNING);
+}
+
+void Miner::stopped() {
+  setState(STATE_STOPPED);
+}
+
+void Miner::socketError() {
+  if (m_probeState == PROBE_RUNNING) {
+    finishProbe(false);
+    return;
+  } else if (m_probeState == PROBE_FINISHED || m_standby) {
+    // A standby session reconnects on its own and never takes the miner out of the stopped state.
+    return;
+  }
+
+  setState(STATE_ERROR);
+  resetHashRateStatistics();
+}
+
+void Miner::difficultyChanged(quint32 _difficulty) {
+  Q_EMIT difficultyChangedSignal(_difficulty);
+}
+
+void Miner::goodShareCountChanged(quint32 _goodShareCount) {
+  Q_EMIT goodShareCountChangedSignal(_goodShareCount);
+}
+
+void Miner::badShareCountChanged(quint32 _badShareCount) {
+  Q_EMIT badShareCountChangedSignal(_badShareCount);
+}
+
+void Miner::staleShareCountChanged(quint32 _staleShareCount) {
+  Q_EMIT staleShareCountChangedSignal(_staleShareCount);
+}
+
+void Miner::connectionErrorCountChanged(quint32 _connectionErrorCount) {
+  Q_EMIT connectionErrorCountChangedSignal(_connectionErrorCount);
+}
+
+void Miner::lastConnectionErrorTimeChanged(const QDateTime& _lastConnectionErrorTime) {
+  Q_EMIT lastConnectionErrorTimeChangedSignal(_lastConnectionErrorTime);
+}
+
+void Miner::timerEvent(QTimerEvent* _event) {
+  if (_event->timerId() == m_hashRateTimerId) {
+    sampleHashCounts();
+    Q_EMIT hashRateChangedSignal(getHashRate());
+    Q_EMIT alternateHashRateChangedSignal(getAlternateHashRate());
+    updateAutoDifficulty();
+    return;
+  } else if (_event->timerId() == m_probeTimerId) {
+    WalletLogger::debug(tr("[Miner] Probe of %1:%2 timed out").arg(getPoolHost()).arg(getPoolPort()));
+    finishProbe(false);
+    return;
+  }
+
+  QObject::timerEvent(_event);
+}
+
+void Miner::setState(State _newState) {
+  if (m_minerState != _newState) {
+    m_minerState = _newState;
+    Q_EMIT stateChangedSignal(m_minerState);
+  }
+}
+
+void Miner::updateLatency() {
+  const double connectTime = m_mainStratumClient->getConnectLatency() / NANOSECONDS_PER_MILLISECOND;
+  const double loginTime = m_mainStratumClient->getLoginLatency() / NANOSECONDS_PER_MILLISECOND;
+  if (connectTime < 0 || loginTime < 0) {
+    return;
+  }
+
+  if (!m_latencyMeasured) {
+    m_connectTime = connectTime;
+    m_loginTime = loginTime;
+    m_latencyMeasured = true;
+  } else {
+    m_connectTime += LATENCY_SMOOTHING_FACTOR * (connectTime - m_connectTime);
+    m_loginTime += LATENCY_SMOOTHING_FACTOR * (loginTime - m_loginTime);
+  }
+}
+
+// Only the main account's hashes count: the alternate client keeps the difficulty it was created with.
+// A pool-assigned difficulty is the reference while the login asks for none.
+void Miner::updateAutoDifficulty() {
+  if (m_targetSharesPerMinute == 0 || m_minerState != STATE_RUNNING || !m_workerPool.isAttached(m_workSource) ||
+    m_hashRateClock.elapsed() < AUTO_DIFFICULTY_WARMUP ||
+    (m_difficultyUpdateClock.isValid() && m_difficultyUpdateClock.elapsed() < MIN_AUTO_DIFFICULTY_INTERVAL)) {
+    return;
+  }
+
+  const double hashRate = m_hashRateStatistics.getHashRate(HashRateWindow::SECONDS_60);
+  if (hashRate <= 0) {
+    return;
+  }
+
+  const quint32 difficulty = static_cast<quint32>(qBound(MIN_AUTO_DIFFICULTY,
+    qRound64(hashRate * SECONDS_PER_MINUTE / m_targetSharesPerMinute), MAX_AUTO_DIFFICULTY));
+  const quint32 loginDifficulty = m_mainStratumClient->getLoginDifficulty();
+  const quint32 currentDifficulty = loginDifficulty > 0 ? loginDifficulty : getDifficulty();
+  const quint64 drift = difficulty > currentDifficulty ? difficulty - currentDifficulty : currentDifficulty - difficulty;
+  if (currentDifficulty > 0 && drift * 100 <= static_cast<quint64>(currentDifficulty) * m_difficultyDriftThreshold) {
+    return;
+  }
+
+  WalletLogger::info(tr("[Miner] %1:%2: %3 H/s asks for difficulty %4 instead of %5").arg(getPoolHost()).
+    arg(getPoolPort()).arg(hashRate, 0, 'f', 1).arg(difficulty).arg(currentDifficulty));
+  m_difficultyUpdateClock.start();
+  m_mainStratumClient->setLoginDifficulty(difficulty);
+}
+
+void Miner::finishProbe(bool _succeeded) {
+  if (m_probeTimerId != -1) {
+    killTimer(m_probeTimerId);
+    m_probeTimerId = -1;
+  }
+
+  m_failedProbeCount = _succeeded ? 0 : m_failedProbeCount + 1;
+  m_probeState = PROBE_FINISHED;
+  // Called from inside the client's own signal handlers, so the disconnect waits for the event loop.
+  QTimer::singleShot(0, this, [this]() {
+    if (m_probeState == PROBE_FINISHED) {
+      cancelProbe();
+    }
+  });
+}
+
+// Forgets the sampled worker counters as well, so the next sample starts from their current values
+// instead of crediting this miner with whatever the workers did for other pools in the meantime.
+void Miner::resetHashRateStatistics() {
+  m_hashRateStatistics.reset();
+  m_alternateHashRateStatistics.reset();
+  m_workerHashRateStatistics.clear();
+  m_workerHashCounts.clear();
+  m_hashRateClock.start();
+  sampleHashCounts();
+}
+
+// Worker counters only ever grow and the workers are shared by all pools, so every sample adds what
+// each worker did since the previous sample, but only while the workers are attached to this miner.
+// The statistics work with differences between samples; nothing is reset under the workers' feet.
+void Miner::sampleHashCounts() {
+  const qint64 timestamp = m_hashRateClock.elapsed();
+  const bool attached = m_workerPool.isAttached(m_workSource);
+  const QList<const IMinerWorker*> workers = m_workerPool.getWorkers();
+  for (int i = 0; i < workers.size(); ++i) {
+    const quint64 workerHashCount = workers[i]->getHashCount();
+    const quint64 workerAlternateHashCount = workers[i]->getAlternateHashCount();
+    if (i >= m_workerHashCounts.size()) {
+      m_workerHashCounts.append({workerHashCount, workerAlternateHashCount, 0});
+      m_workerHashRateStatistics.append(HashRateStatistics());
+    }
+
+    WorkerHashCount& counts = m_workerHashCounts[i];
+    if (attached) {
+      const quint64 hashes = workerHashCount - counts.sampledHashCount;
+      const quint64 alternateHashes = workerAlternateHashCount - counts.sampledAlternateHashCount;
+      m_hashCount += hashes;
+      m_alternateHashCount += alternateHashes;
+      counts.hashCount += hashes + alternateHashes;
+    }
+
+    counts.sampledHashCount = workerHashCount;
+    counts.sampledAlternateHashCount = workerAlternateHashCount;
+    m_workerHashRateStatistics[i].addSample(timestamp, counts.hashCount);
+  }
+
+  m_hashRateStatistics.addSample(timestamp, m_hashCount);
+  m_alternateHashRateStatistics.addSample(timestamp, m_alternateHashCount);
+}
+
+}
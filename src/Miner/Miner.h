@@ -1,94 +1,147 @@
-// Copyright (c) 2015-2018, The Bytecoin developers.
-// Licensed under the GNU Lesser General Public License. See LICENSE for details.
-
-#pragma once
-
-#include <QMap>
-#include <QMetaObject>
-#include <QObject>
-#include <QReadWriteLock>
-
-#include <atomic>
-
-#include "IPoolMiner.h"
-#include "IMinerWorker.h"
-#include "IPoolClient.h"
-
-namespace WalletGUI {
-
-class StratumClient;
-
-class Miner : public QObject, public IPoolMiner, public IPoolClientObserver {
-  Q_OBJECT
-  Q_DISABLE_COPY(Miner)
-
-public:
-  Miner(const QString& _host, quint16 _port, quint32 _difficulty, const QString& _login, const QString& _password, QObject* _parent);
-  ~Miner();
-
-  // IPoolMiner
-  virtual void start(quint32 _coreCount) override;
-  virtual void stop() override;
-  virtual QString getPoolHost() const override;
-  virtual quint16 getPoolPort() const override;
-  virtual State getCurrentState() const override;
-  virtual quint32 getHashRate() const override;
-  virtual quint32 getAlternateHashRate() const override;
-  virtual quint32 getDifficulty() const override;
-  virtual quint32 getGoodShareCount() const override;
-  virtual quint32 getGoodAlternateShareCount() const override;
-  virtual quint32 getBadShareCount() const override;
-  virtual quint32 getConnectionErrorCount() const override;
-  virtual QDateTime getLastConnectionErrorTime() const override;
-  virtual void setAlternateAccount(const QString& _login, quint32 _probability) override;
-  virtual void unsetAlternateAccount() override;
-  virtual void addObserver(IPoolMinerObserver* _observer) override;
-  virtual void removeObserver(IPoolMinerObserver* _observer) override;
-
-  // IPoolClientObserver
-  Q_SLOT virtual void started() override;
-  Q_SLOT virtual void stopped() override;
-  Q_SLOT virtual void socketError() override;
-  Q_SLOT virtual void difficultyChanged(quint32 _difficulty) override;
-  Q_SLOT virtual void goodShareCountChanged(quint32 _goodShareCount) override;
-  Q_SLOT virtual void badShareCountChanged(quint32 _badShareCount) override;
-  Q_SLOT virtual void connectionErrorCountChanged(quint32 _connectionErrorCount) override;
-  Q_SLOT virtual void lastConnectionErrorTimeChanged(const QDateTime& _lastConnectionErrorTime) override;
-
-protected:
-  void timerEvent(QTimerEvent* _event) override;
-
-private:
-  State m_minerState;
-  Job m_mainJob;
-  Job m_alternateJob;
-  QReadWriteLock m_mainJobLock;
-  QReadWriteLock m_alternateJobLock;
-  StratumClient* m_mainStratumClient;
-  StratumClient* m_alternateStratumClient;
-  std::atomic<quint32> m_mainNonce;
-  std::atomic<quint32> m_alternateNonce;
-  std::atomic<quint32> m_hashCounter;
-  std::atomic<quint32> m_alternameHashCounter;
-  std::atomic<quint32> m_alternateProbability;
-  quint32 m_hashCountPerSecond;
-  quint32 m_alternateHashCountPerSecond;
-  QList<QPair<QThread*, IMinerWorker*> > m_workerThreadList;
-  int m_hashRateTimerId;
-  QMap<IPoolMinerObserver*, QList<QMetaObject::Connection>> m_observerConnections;
-
-  void setState(State _newState);
-
-Q_SIGNALS:
-  void stateChangedSignal(int _newState);
-  void hashRateChangedSignal(quint32 _hashRate);
-  void alternateHashRateChangedSignal(quint32 _hashRate);
-  void difficultyChangedSignal(quint32 _difficulty);
-  void goodShareCountChangedSignal(quint32 _goodShareCount);
-  void goodAlternateShareCountChangedSignal(quint32 _goodShareCount);
-  void badShareCountChangedSignal(quint32 _badShareCount);
-  void connectionErrorCountChangedSignal(quint32 _connectionErrorCount);
-  void lastConnectionErrorTimeChangedSignal(const QDateTime& _lastConnectionErrorTime);
-};
-
-}
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#pragma once
+
+#include <QElapsedTimer>
+#include <QMap>
+#include <QMetaObject>
+#include <QObject>
+
+#include <atomic>
+
+#include "IPoolMiner.h"
+#include "IMinerWorker.h"
+#include "IPoolClient.h"
+#include "HashRateStatistics.h"
+#include "JobSlot.h"
+#include "ShareQueue.h"
+#include "Worker.h"
+
+namespace WalletGUI {
+
+class StratumClient;
+class WorkerPool;
+
+class Miner : public QObject, public IPoolMiner, public IPoolClientObserver {
+  Q_OBJECT
+  Q_DISABLE_COPY(Miner)
+
+public:
+  Miner(WorkerPool& _workerPool, const QString& _host, quint16 _port, quint32 _difficulty, const QString& _login,
+    const QString& _password, QObject* _parent);
+  ~Miner();
+
+  // IPoolMiner
+  virtual void start() override;
+  virtual void stop() override;
+  virtual void probe() override;
+  virtual void cancelProbe() override;
+  virtual bool isProbing() const override;
+  virtual PoolLatency getPoolLatency() const override;
+  virtual void startStandby() override;
+  virtual void stopStandby() override;
+  virtual bool isStandby() const override;
+  virtual bool isStandbyReady() const override;
+  virtual QString getPoolHost() const override;
+  virtual quint16 getPoolPort() const override;
+  virtual State getCurrentState() const override;
+  virtual quint32 getHashRate() const override;
+  virtual quint32 getAlternateHashRate() const override;
+  virtual quint32 getAlternateProbability() const override;
+  virtual double getAlternateHashShare(HashRateWindow _window) const override;
+  virtual double getAverageHashRate(HashRateWindow _window) const override;
+  virtual double getEwmaHashRate() const override;
+  virtual QList<double> getWorkerHashRates() const override;
+  virtual quint32 getDifficulty() const override;
+  virtual quint32 getGoodShareCount() const override;
+  virtual quint32 getGoodAlternateShareCount() const override;
+  virtual quint32 getBadShareCount() const override;
+  virtual quint32 getStaleShareCount() const override;
+  virtual double getSubmitLatency(double _fraction) const override;
+  virtual const LatencyHistogram& getSubmitLatencyHistogram() const override;
+  virtual quint32 getConnectionErrorCount() const override;
+  virtual QDateTime getLastConnectionErrorTime() const override;
+  virtual void setAlternateAccount(const QString& _login, quint32 _probability) override;
+  virtual void unsetAlternateAccount() override;
+  virtual void setAutoDifficulty(quint32 _sharesPerMinute, quint32 _driftThreshold) override;
+  virtual void addObserver(IPoolMinerObserver* _observer) override;
+  virtual void removeObserver(IPoolMinerObserver* _observer) override;
+
+  // IPoolClientObserver
+  Q_SLOT virtual void started() override;
+  Q_SLOT virtual void stopped() override;
+  Q_SLOT virtual void socketError() override;
+  Q_SLOT virtual void difficultyChanged(quint32 _difficulty) override;
+  Q_SLOT virtual void goodShareCountChanged(quint32 _goodShareCount) override;
+  Q_SLOT virtual void badShareCountChanged(quint32 _badShareCount) override;
+  Q_SLOT virtual void staleShareCountChanged(quint32 _staleShareCount) override;
+  Q_SLOT virtual void connectionErrorCountChanged(quint32 _connectionErrorCount) override;
+  Q_SLOT virtual void lastConnectionErrorTimeChanged(const QDateTime& _lastConnectionErrorTime) override;
+
+protected:
+  void timerEvent(QTimerEvent* _event) override;
+
+private:
+  enum ProbeState {
+    PROBE_IDLE, PROBE_RUNNING, PROBE_FINISHED
+  };
+
+  // Hashes one pool worker did for this miner, and the worker's own counters at the last sample.
+  struct WorkerHashCount {
+    quint64 sampledHashCount;
+    quint64 sampledAlternateHashCount;
+    quint64 hashCount;
+  };
+
+  WorkerPool& m_workerPool;
+  State m_minerState;
+  JobSlot m_mainJobSlot;
+  JobSlot m_alternateJobSlot;
+  ShareQueue m_mainShareQueue;
+  ShareQueue m_alternateShareQueue;
+  StratumClient* m_mainStratumClient;
+  StratumClient* m_alternateStratumClient;
+  std::atomic<quint32> m_alternateProbability;
+  const WorkSource m_workSource;
+  quint64 m_hashCount;
+  quint64 m_alternateHashCount;
+  QVector<WorkerHashCount> m_workerHashCounts;
+  QElapsedTimer m_hashRateClock;
+  HashRateStatistics m_hashRateStatistics;
+  HashRateStatistics m_alternateHashRateStatistics;
+  QVector<HashRateStatistics> m_workerHashRateStatistics;
+  int m_hashRateTimerId;
+  ProbeState m_probeState;
+  int m_probeTimerId;
+  bool m_latencyMeasured;
+  double m_connectTime;
+  double m_loginTime;
+  quint32 m_failedProbeCount;
+  bool m_standby;
+  quint32 m_targetSharesPerMinute;
+  quint32 m_difficultyDriftThreshold;
+  QElapsedTimer m_difficultyUpdateClock;
+  QMap<IPoolMinerObserver*, QList<QMetaObject::Connection>> m_observerConnections;
+
+  void setState(State _newState);
+  void resetHashRateStatistics();
+  void sampleHashCounts();
+  void updateLatency();
+  void updateAutoDifficulty();
+  void finishProbe(bool _succeeded);
+
+Q_SIGNALS:
+  void stateChangedSignal(int _newState);
+  void hashRateChangedSignal(quint32 _hashRate);
+  void alternateHashRateChangedSignal(quint32 _hashRate);
+  void difficultyChangedSignal(quint32 _difficulty);
+  void goodShareCountChangedSignal(quint32 _goodShareCount);
+  void goodAlternateShareCountChangedSignal(quint32 _goodShareCount);
+  void badShareCountChangedSignal(quint32 _badShareCount);
+  void staleShareCountChangedSignal(quint32 _staleShareCount);
+  void connectionErrorCountChangedSignal(quint32 _connectionErrorCount);
+  void lastConnectionErrorTimeChangedSignal(const QDateTime& _lastConnectionErrorTime);
+};
+
+}
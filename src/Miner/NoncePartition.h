@@ -0,0 +1,49 @@
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#pragma once
+
+#include <QtGlobal>
+
+namespace WalletGUI {
+
+// Splits the 32-bit nonce space between miner instances that share one pool login. The top
+// bitCount bits of every nonce carry the instance id and the workers of an instance only search
+// the remaining bits, so instances never submit each other's shares. With bitCount 0 the whole
+// space belongs to one instance. Packs into a single quint64 so workers can read it atomically.
+class NoncePartition {
+public:
+  static const quint32 MAX_BIT_COUNT = 8;
+
+  NoncePartition() : m_prefix(0), m_counterMask(0xffffffff) {
+  }
+
+  NoncePartition(quint32 _instanceId, quint32 _bitCount) : NoncePartition() {
+    const quint32 bitCount = _bitCount < MAX_BIT_COUNT ? _bitCount : MAX_BIT_COUNT;
+    if (bitCount > 0) {
+      m_counterMask = 0xffffffff >> bitCount;
+      m_prefix = (_instanceId & ((1u << bitCount) - 1)) << (32 - bitCount);
+    }
+  }
+
+  static NoncePartition unpack(quint64 _packed) {
+    NoncePartition partition;
+    partition.m_prefix = static_cast<quint32>(_packed >> 32);
+    partition.m_counterMask = static_cast<quint32>(_packed);
+    return partition;
+  }
+
+  quint64 pack() const {
+    return (static_cast<quint64>(m_prefix) << 32) | m_counterMask;
+  }
+
+  quint32 apply(quint32 _counter) const {
+    return m_prefix | (_counter & m_counterMask);
+  }
+
+private:
+  quint32 m_prefix;
+  quint32 m_counterMask;
+};
+
+}
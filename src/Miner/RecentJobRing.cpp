@@ -0,0 +1,90 @@
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#include "RecentJobRing.h"
+
+namespace WalletGUI {
+
+namespace {
+
+const qint64 SUBMIT_GRACE_PERIOD = 60ll * 1000 * 1000 * 1000;
+const int PREVIOUS_BLOCK_HASH_SIZE = 32;
+
+// A block hashing blob starts with varint major and minor versions and a varint timestamp, followed
+// by the hash of the previous block.
+bool skipVarint(const QByteArray& _blob, int& _offset) {
+  while (_offset < _blob.size()) {
+    if ((static_cast<quint8>(_blob[_offset++]) & 0x80) == 0) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+QByteArray getPreviousBlockHash(const QByteArray& _blob) {
+  int offset = 0;
+  if (!skipVarint(_blob, offset) || !skipVarint(_blob, offset) || !skipVarint(_blob, offset) ||
+    offset + PREVIOUS_BLOCK_HASH_SIZE > _blob.size()) {
+    return QByteArray();
+  }
+
+  return _blob.mid(offset, PREVIOUS_BLOCK_HASH_SIZE);
+}
+
+}
+
+RecentJobRing::RecentJobRing() : m_nextEntry(0) {
+  clear();
+}
+
+RecentJobRing::~RecentJobRing() {
+}
+
+void RecentJobRing::retire(const std::shared_ptr<const Job>& _job, const Job& _replacement, qint64 _time) {
+  if (!_job) {
+    return;
+  }
+
+  const QByteArray previousBlockHash = getPreviousBlockHash(_job->blob);
+  const bool sameBlock = !previousBlockHash.isEmpty() && previousBlockHash == getPreviousBlockHash(_replacement.blob);
+  if (!sameBlock) {
+    for (Entry& entry : m_entries) {
+      entry.policy = POLICY_STALE;
+    }
+  }
+
+  Entry& entry = m_entries[m_nextEntry];
+  entry.job = _job;
+  entry.policy = sameBlock ? POLICY_SUBMIT : POLICY_STALE;
+  entry.expiryTime = _time + SUBMIT_GRACE_PERIOD;
+  m_nextEntry = (m_nextEntry + 1) % CAPACITY;
+}
+
+RecentJobRing::Policy RecentJobRing::lookup(quint64 _generation, qint64 _time, std::shared_ptr<const Job>& _job) const {
+  for (const Entry& entry : m_entries) {
+    if (entry.job && entry.job->generation == _generation) {
+      if (entry.policy != POLICY_SUBMIT || _time >= entry.expiryTime) {
+        return POLICY_STALE;
+      }
+
+      _job = entry.job;
+      return POLICY_SUBMIT;
+    }
+  }
+
+  // Older than anything remembered, or from a previous session.
+  return POLICY_STALE;
+}
+
+void RecentJobRing::clear() {
+  for (Entry& entry : m_entries) {
+    entry.job.reset();
+    entry.policy = POLICY_STALE;
+    entry.expiryTime = 0;
+  }
+
+  m_nextEntry = 0;
+}
+
+}
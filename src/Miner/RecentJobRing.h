@@ -0,0 +1,49 @@
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#pragma once
+
+#include <QtGlobal>
+
+#include <memory>
+
+#include "IMinerWorker.h"
+
+namespace WalletGUI {
+
+// The last few jobs that were replaced by the pool, so that a share found just before a job
+// notification can still be matched by its job generation.
+//
+// Each retired job carries its own policy. A job replaced by another job on the same previous block
+// (new difficulty, new extra nonce) stays submittable for a grace period, because pools keep a short
+// list of valid jobs. A job replaced because a new block arrived is stale at once, and so is every
+// older entry, since the pool rejects shares for an outdated block.
+class RecentJobRing {
+  Q_DISABLE_COPY(RecentJobRing)
+
+public:
+  enum Policy {
+    POLICY_SUBMIT, POLICY_STALE
+  };
+
+  static const int CAPACITY = 4;
+
+  RecentJobRing();
+  ~RecentJobRing();
+
+  void retire(const std::shared_ptr<const Job>& _job, const Job& _replacement, qint64 _time);
+  Policy lookup(quint64 _generation, qint64 _time, std::shared_ptr<const Job>& _job) const;
+  void clear();
+
+private:
+  struct Entry {
+    std::shared_ptr<const Job> job;
+    Policy policy;
+    qint64 expiryTime;
+  };
+
+  Entry m_entries[CAPACITY];
+  int m_nextEntry;
+};
+
+}
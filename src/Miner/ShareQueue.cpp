@@ -0,0 +1,85 @@
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#include <chrono>
+#include <cstring>
+
+#include "ShareQueue.h"
+
+namespace WalletGUI {
+
+const quint32 ShareQueue::CAPACITY;
+
+ShareQueue::ShareQueue(QObject* _parent) : QObject(_parent), m_cells(new Cell[CAPACITY]), m_enqueuePosition(0),
+  m_dequeuePosition(0), m_notificationPending(false), m_droppedCount(0) {
+  static_assert((CAPACITY & (CAPACITY - 1)) == 0, "Share queue capacity must be a power of two");
+  for (quint32 i = 0; i < CAPACITY; ++i) {
+    m_cells[i].sequence.store(i, std::memory_order_relaxed);
+  }
+}
+
+ShareQueue::~ShareQueue() {
+}
+
+qint64 ShareQueue::getTimestamp() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// A cell is free for position p when its sequence equals p and holds a record once the sequence is
+// p + 1. Producers claim a position with a CAS on the enqueue position, so no lock is ever taken.
+bool ShareQueue::push(quint64 _jobGeneration, quint32 _nonce, const void* _hash) {
+  const qint64 foundTime = getTimestamp();
+  quint64 position = m_enqueuePosition.load(std::memory_order_relaxed);
+  Cell* cell = nullptr;
+  for (;;) {
+    cell = &m_cells[position & (CAPACITY - 1)];
+    const quint64 sequence = cell->sequence.load(std::memory_order_acquire);
+    const qint64 difference = static_cast<qint64>(sequence - position);
+    if (difference == 0) {
+      if (m_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+        break;
+      }
+    } else if (difference < 0) {
+      m_droppedCount.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    } else {
+      position = m_enqueuePosition.load(std::memory_order_relaxed);
+    }
+  }
+
+  cell->record.jobGeneration = _jobGeneration;
+  cell->record.nonce = _nonce;
+  std::memcpy(cell->record.hash, _hash, ShareRecord::HASH_SIZE);
+  cell->record.foundTime = foundTime;
+  cell->sequence.store(position + 1, std::memory_order_release);
+
+  if (!m_notificationPending.exchange(true, std::memory_order_acq_rel)) {
+    Q_EMIT sharesAvailableSignal();
+  }
+
+  return true;
+}
+
+bool ShareQueue::pop(ShareRecord& _record) {
+  Cell& cell = m_cells[m_dequeuePosition & (CAPACITY - 1)];
+  if (cell.sequence.load(std::memory_order_acquire) != m_dequeuePosition + 1) {
+    return false;
+  }
+
+  _record = cell.record;
+  cell.sequence.store(m_dequeuePosition + CAPACITY, std::memory_order_release);
+  ++m_dequeuePosition;
+  return true;
+}
+
+// Must be called before draining: a producer that pushes after this point either is seen by the
+// drain or emits a new notification.
+void ShareQueue::takeNotification() {
+  m_notificationPending.exchange(false, std::memory_order_acq_rel);
+}
+
+quint64 ShareQueue::getDroppedCount() const {
+  return m_droppedCount.load(std::memory_order_relaxed);
+}
+
+}
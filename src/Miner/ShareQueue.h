@@ -0,0 +1,66 @@
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#pragma once
+
+#include <QObject>
+
+#include <atomic>
+#include <memory>
+
+namespace WalletGUI {
+
+struct ShareRecord {
+  static const int HASH_SIZE = 32;
+
+  quint64 jobGeneration;
+  quint32 nonce;
+  quint8 hash[HASH_SIZE];
+  qint64 foundTime;
+};
+
+// Bounded multi-producer, single-consumer ring of found shares.
+//
+// Workers push fixed-size records without allocating; a full ring drops the share and counts it. The
+// first push into an idle queue emits sharesAvailableSignal, which the consumer connects queued and
+// answers by calling takeNotification() and then popping until the ring is empty, so a burst of
+// shares costs a single meta-call. Timestamps come from getTimestamp(), a monotonic nanosecond clock
+// shared by all threads.
+class ShareQueue : public QObject {
+  Q_OBJECT
+  Q_DISABLE_COPY(ShareQueue)
+
+public:
+  static const quint32 CAPACITY = 256;
+
+  explicit ShareQueue(QObject* _parent = nullptr);
+  ~ShareQueue();
+
+  static qint64 getTimestamp();
+
+  bool push(quint64 _jobGeneration, quint32 _nonce, const void* _hash);
+  bool pop(ShareRecord& _record);
+  void takeNotification();
+  quint64 getDroppedCount() const;
+
+private:
+  static const size_t CACHE_LINE_SIZE = 64;
+
+  struct Cell {
+    std::atomic<quint64> sequence;
+    ShareRecord record;
+  };
+
+  std::unique_ptr<Cell[]> m_cells;
+  char m_cellsPadding[CACHE_LINE_SIZE];
+  std::atomic<quint64> m_enqueuePosition;
+  char m_enqueuePadding[CACHE_LINE_SIZE];
+  quint64 m_dequeuePosition;
+  std::atomic<bool> m_notificationPending;
+  std::atomic<quint64> m_droppedCount;
+
+Q_SIGNALS:
+  void sharesAvailableSignal();
+};
+
+}
@@ -1,109 +1,136 @@
-// Copyright (c) 2015-2018, The Bytecoin developers.
-// Licensed under the GNU Lesser General Public License. See LICENSE for details.
-
-#pragma once
-
-#include <QDateTime>
-#include <QMap>
-#include <QMetaObject>
-#include <QObject>
-#include <QReadWriteLock>
-#include <QTcpSocket>
-
-#include <atomic>
-
-#include "IPoolClient.h"
-#include "IMinerWorker.h"
-
-class QTcpSocket;
-
-namespace WalletGUI {
-
-struct JsonRpcRequest {
-  QString method;
-  QVariantMap params;
-};
-
-struct Job;
-
-class StratumClient : public QObject, public IPoolClient, public IMinerWorkerObserver {
-  Q_OBJECT
-  Q_DISABLE_COPY(StratumClient)
-
-public:
-  StratumClient(Job& _job, QReadWriteLock& _jobLock, std::atomic<quint32>& _nonce, const QString& _host,
-    quint16 _port, quint32 _difficulty, const QString& _login, const QString& _password, QObject *parent);
-  ~StratumClient();
-
-  // IPoolClient
-  virtual void start() override;
-  virtual void stop() override;
-  virtual QString getLogin() const override;
-  virtual QString getPoolHost() const override;
-  virtual quint16 getPoolPort() const override;
-  virtual quint32 getDifficulty() const override;
-  virtual quint32 getGoodShareCount() const override;
-  virtual quint32 getBadShareCount() const override;
-  virtual quint32 getConnectionErrorCount() const override;
-  virtual QDateTime getLastConnectionErrorTime() const override;
-  virtual void addObserver(IPoolClientObserver* _observer) override;
-  virtual void removeObserver(IPoolClientObserver* _observer) override;
-
-  // IMinerWorkerObserver
-  Q_SLOT virtual void shareFound(const QString& _jobId, quint32 _nonce, const QByteArray& _result) override;
-
-protected:
-  void timerEvent(QTimerEvent* _event) override;
-
-private:
-  const QString m_host;
-  const quint16 m_port;
-  quint32 m_difficulty;
-  const QString m_login;
-  const QString m_password;
-  QTcpSocket* m_socket;
-  QString m_currentSessionId;
-  Job& m_currentJob;
-  QReadWriteLock& m_jobLock;
-  std::atomic<quint32>& m_nonce;
-  quint64 m_requestCounter;
-  QMap<quint64, JsonRpcRequest> m_activeRequestMap;
-  int m_reconnectTimerId;
-  int m_responseTimerId;
-  quint32 m_goodShareCount;
-  quint32 m_badShareCount;
-  quint32 m_connectionErrorCount;
-  QDateTime m_lastConnectionError;
-  QMap<IPoolClientObserver*, QList<QMetaObject::Connection>> m_observerConnections;
-
-  void connectedToHost();
-  void reconnect();
-  void resetReconnectionTimer();
-  void resetResponseTimer();
-  void readyRead();
-  void processData(const QJsonObject& _jsonObject);
-  void processNotification(const QJsonObject& _jsonObject);
-  void socketError(QTcpSocket::SocketError _error);
-  QByteArray makeJsonRequest(const JsonRpcRequest& _request);
-  void sendRequest(const JsonRpcRequest& _request);
-  void loginRequest();
-
-  void processLoginResponce(const QJsonObject& _responceObject, const JsonRpcRequest& _request);
-  void processSubmitResponce(const QJsonObject& _responceObject, const JsonRpcRequest& _request);
-  void processJobNotification(const QJsonObject& _notificationObject);
-  void updateJob(const QVariantMap& _newJobMap);
-  Q_INVOKABLE void submitShare(const QString& _jobId, quint32 _nonce, const QByteArray& _result);
-
-
-Q_SIGNALS:
-  void startedSignal();
-  void stoppedSignal();
-  void socketErrorSignal();
-  void difficultyChangedSignal(quint32 _difficulty);
-  void goodShareCountChangedSignal(quint32 _goodShareCount);
-  void badShareCountChangedSignal(quint32 _badShareCount);
-  void connectionErrorCountChangedSignal(quint32 _connectionErrorCount);
-  void lastConnectionErrorTimeChangedSignal(const QDateTime& _connectionErrorTime);
-};
-
-}
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#pragma once
+
+#include <QDateTime>
+#include <QMap>
+#include <QMetaObject>
+#include <QObject>
+#include <QTcpSocket>
+
+#include "IPoolClient.h"
+#include "LineFramer.h"
+#include "Metrics/LatencyHistogram.h"
+#include "RecentJobRing.h"
+#include "TimerWheel.h"
+
+class QTcpSocket;
+
+namespace WalletGUI {
+
+struct JsonRpcRequest {
+  QString method;
+  QVariantMap params;
+  qint64 shareFoundTime = 0;
+  qint64 sentTime = 0;
+};
+
+struct Job;
+struct ShareRecord;
+class JobSlot;
+class ShareQueue;
+
+class StratumClient : public QObject, public IPoolClient {
+  Q_OBJECT
+  Q_DISABLE_COPY(StratumClient)
+
+public:
+  StratumClient(JobSlot& _jobSlot, ShareQueue& _shareQueue, const QString& _host, quint16 _port, quint32 _difficulty, const QString& _login, const QString& _password, QObject *parent);
+  ~StratumClient();
+
+  // IPoolClient
+  virtual void start() override;
+  virtual void stop() override;
+  virtual QString getLogin() const override;
+  virtual QString getPoolHost() const override;
+  virtual quint16 getPoolPort() const override;
+  virtual quint32 getDifficulty() const override;
+  virtual quint32 getGoodShareCount() const override;
+  virtual quint32 getBadShareCount() const override;
+  virtual quint32 getStaleShareCount() const override;
+  virtual quint32 getConnectionErrorCount() const override;
+  virtual QDateTime getLastConnectionErrorTime() const override;
+  virtual void addObserver(IPoolClientObserver* _observer) override;
+  virtual void removeObserver(IPoolClientObserver* _observer) override;
+
+  bool isLoggedIn() const;
+  // Like stop(), but drops the connection at once instead of waiting up to RECONNECT_TIMER_INTERVAL for the
+  // pool to close it. For sessions nobody is waiting on, such as latency probes.
+  void abort();
+  // Difficulty requested at login, 0 for the pool's default. A change logs in again right away.
+  quint32 getLoginDifficulty() const;
+  void setLoginDifficulty(quint32 _difficulty);
+  const LatencyHistogram& getSubmitLatencyHistogram() const;
+  // Nanoseconds taken by the last TCP connect and login round trip, -1 until measured.
+  qint64 getConnectLatency() const;
+  qint64 getLoginLatency() const;
+
+protected:
+  void timerEvent(QTimerEvent* _event) override;
+
+private:
+  const QString m_host;
+  const quint16 m_port;
+  quint32 m_difficulty;
+  const QString m_login;
+  const QString m_password;
+  QTcpSocket* m_socket;
+  LineFramer m_lineFramer;
+  QString m_currentSessionId;
+  JobSlot& m_jobSlot;
+  RecentJobRing m_recentJobs;
+  ShareQueue& m_shareQueue;
+  quint64 m_droppedShareCount;
+  quint64 m_requestCounter;
+  QMap<quint64, JsonRpcRequest> m_activeRequestMap;
+  int m_reconnectTimerId;
+  int m_requestTimerId;
+  TimerWheel m_requestDeadlines;
+  quint32 m_consecutiveTimeoutCount;
+  LatencyHistogram m_submitLatencyHistogram;
+  qint64 m_connectStartTime;
+  qint64 m_connectLatency;
+  qint64 m_loginLatency;
+  quint32 m_goodShareCount;
+  quint32 m_badShareCount;
+  quint32 m_staleShareCount;
+  quint32 m_connectionErrorCount;
+  QDateTime m_lastConnectionError;
+  QMap<IPoolClientObserver*, QList<QMetaObject::Connection>> m_observerConnections;
+
+  void connectedToHost();
+  void reconnect();
+  void resetReconnectionTimer();
+  void resetRequestTimer();
+  void resetSession();
+  void expireRequests();
+  void readyRead();
+  void processData(const QJsonObject& _jsonObject);
+  void processNotification(const QJsonObject& _jsonObject);
+  void socketError(QTcpSocket::SocketError _error);
+  QByteArray makeJsonRequest(const JsonRpcRequest& _request);
+  void sendRequest(const JsonRpcRequest& _request);
+  void loginRequest();
+
+  void processLoginResponce(const QJsonObject& _responceObject, const JsonRpcRequest& _request);
+  void processSubmitResponce(const QJsonObject& _responceObject, const JsonRpcRequest& _request);
+  void processJobNotification(const QJsonObject& _notificationObject);
+  void updateJob(const QVariantMap& _newJobMap);
+  void applyJob(const Job& _job);
+  void sharesAvailable();
+  void submitShare(const ShareRecord& _share);
+
+Q_SIGNALS:
+  void startedSignal();
+  void stoppedSignal();
+  void socketErrorSignal();
+  void difficultyChangedSignal(quint32 _difficulty);
+  void goodShareCountChangedSignal(quint32 _goodShareCount);
+  void badShareCountChangedSignal(quint32 _badShareCount);
+  void staleShareCountChangedSignal(quint32 _staleShareCount);
+  void connectionErrorCountChangedSignal(quint32 _connectionErrorCount);
+  void lastConnectionErrorTimeChangedSignal(const QDateTime& _connectionErrorTime);
+};
+
+}
@@ -0,0 +1,289 @@
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#include <cstring>
+
+#include "HashAlgorithm.h"
+#include "IMinerWorker.h"
+#include "StratumJobParser.h"
+
+namespace WalletGUI {
+
+namespace {
+
+const int MAX_NESTING_DEPTH = 32;
+
+struct StringSpan {
+  const char* data;
+  int size;
+  bool hasEscapes;
+
+  bool equals(const char* _text) const {
+    const int textSize = static_cast<int>(std::strlen(_text));
+    return !hasEscapes && size == textSize && std::memcmp(data, _text, textSize) == 0;
+  }
+};
+
+class Scanner {
+public:
+  Scanner(const char* _data, int _size) : m_position(_data), m_end(_data + _size) {
+  }
+
+  bool atEnd() {
+    skipSpace();
+    return m_position == m_end;
+  }
+
+  bool consume(char _char) {
+    skipSpace();
+    if (m_position != m_end && *m_position == _char) {
+      ++m_position;
+      return true;
+    }
+
+    return false;
+  }
+
+  bool readString(StringSpan& _span) {
+    if (!consume('"')) {
+      return false;
+    }
+
+    _span.data = m_position;
+    _span.hasEscapes = false;
+    while (m_position != m_end && *m_position != '"') {
+      if (*m_position == '\\') {
+        _span.hasEscapes = true;
+        if (++m_position == m_end) {
+          return false;
+        }
+      }
+
+      ++m_position;
+    }
+
+    if (m_position == m_end) {
+      return false;
+    }
+
+    _span.size = static_cast<int>(m_position - _span.data);
+    ++m_position;
+    return true;
+  }
+
+  // A string's contents, or the text of a number or literal, for fields that pools send either way.
+  bool readScalar(StringSpan& _span) {
+    skipSpace();
+    if (m_position != m_end && *m_position == '"') {
+      return readString(_span);
+    }
+
+    return readLiteral(_span);
+  }
+
+  bool skipValue(int _depth = 0) {
+    if (_depth > MAX_NESTING_DEPTH) {
+      return false;
+    }
+
+    skipSpace();
+    if (m_position == m_end) {
+      return false;
+    }
+
+    StringSpan span;
+    switch (*m_position) {
+    case '"':
+      return readString(span);
+    case '{':
+      ++m_position;
+      if (consume('}')) {
+        return true;
+      }
+
+      do {
+        if (!readString(span) || !consume(':') || !skipValue(_depth + 1)) {
+          return false;
+        }
+      } while (consume(','));
+
+      return consume('}');
+    case '[':
+      ++m_position;
+      if (consume(']')) {
+        return true;
+      }
+
+      do {
+        if (!skipValue(_depth + 1)) {
+          return false;
+        }
+      } while (consume(','));
+
+      return consume(']');
+    default:
+      return readLiteral(span);
+    }
+  }
+
+private:
+  const char* m_position;
+  const char* const m_end;
+
+  // Numbers and literals: anything up to the next structural character.
+  bool readLiteral(StringSpan& _span) {
+    _span.data = m_position;
+    _span.hasEscapes = false;
+    while (m_position != m_end && std::strchr(",}] \t\r\n", *m_position) == nullptr) {
+      ++m_position;
+    }
+
+    _span.size = static_cast<int>(m_position - _span.data);
+    return _span.size > 0;
+  }
+
+  void skipSpace() {
+    while (m_position != m_end && (*m_position == ' ' || *m_position == '\t' || *m_position == '\r' || *m_position == '\n')) {
+      ++m_position;
+    }
+  }
+};
+
+int hexDigit(char _char) {
+  if (_char >= '0' && _char <= '9') {
+    return _char - '0';
+  } else if (_char >= 'a' && _char <= 'f') {
+    return _char - 'a' + 10;
+  } else if (_char >= 'A' && _char <= 'F') {
+    return _char - 'A' + 10;
+  }
+
+  return -1;
+}
+
+bool decodeHex(const char* _hex, int _size, char* _output) {
+  for (int i = 0; i < _size / 2; ++i) {
+    const int high = hexDigit(_hex[2 * i]);
+    const int low = hexDigit(_hex[2 * i + 1]);
+    if (high < 0 || low < 0) {
+      return false;
+    }
+
+    _output[i] = static_cast<char>((high << 4) | low);
+  }
+
+  return true;
+}
+
+}
+
+bool parseJobNotification(const char* _data, int _size, Job& _job) {
+  Scanner scanner(_data, _size);
+  if (!scanner.consume('{')) {
+    return false;
+  }
+
+  bool isJobMethod = false;
+  bool hasParams = false;
+  StringSpan jobId = {nullptr, 0, false};
+  StringSpan blob = {nullptr, 0, false};
+  StringSpan target = {nullptr, 0, false};
+  StringSpan algorithm = {nullptr, 0, false};
+  StringSpan variant = {nullptr, 0, false};
+  do {
+    StringSpan key;
+    if (!scanner.readString(key) || !scanner.consume(':')) {
+      return false;
+    }
+
+    if (key.equals("method")) {
+      StringSpan method;
+      if (!scanner.readString(method)) {
+        return false;
+      }
+
+      isJobMethod = method.equals("job");
+    } else if (key.equals("id")) {
+      // Anything with an id is a response as far as StratumClient is concerned.
+      return false;
+    } else if (key.equals("params")) {
+      if (!scanner.consume('{')) {
+        return false;
+      }
+
+      hasParams = true;
+      if (!scanner.consume('}')) {
+        do {
+          StringSpan paramKey;
+          if (!scanner.readString(paramKey) || !scanner.consume(':')) {
+            return false;
+          }
+
+          if (paramKey.equals("job_id")) {
+            if (!scanner.readString(jobId)) {
+              return false;
+            }
+          } else if (paramKey.equals("blob")) {
+            if (!scanner.readString(blob)) {
+              return false;
+            }
+          } else if (paramKey.equals("target")) {
+            if (!scanner.readString(target)) {
+              return false;
+            }
+          } else if (paramKey.equals("algo")) {
+            if (!scanner.readString(algorithm) || algorithm.hasEscapes) {
+              return false;
+            }
+          } else if (paramKey.equals("variant")) {
+            if (!scanner.readScalar(variant) || variant.hasEscapes) {
+              return false;
+            }
+          } else if (!scanner.skipValue()) {
+            return false;
+          }
+        } while (scanner.consume(','));
+
+        if (!scanner.consume('}')) {
+          return false;
+        }
+      }
+    } else if (!scanner.skipValue()) {
+      return false;
+    }
+  } while (scanner.consume(','));
+
+  if (!scanner.consume('}') || !scanner.atEnd() || !isJobMethod || !hasParams) {
+    return false;
+  }
+
+  if (jobId.data == nullptr || jobId.size == 0 || jobId.hasEscapes || blob.data == nullptr || blob.hasEscapes ||
+    blob.size % 2 != 0 || target.data == nullptr || target.hasEscapes || target.size < 8 || target.size % 2 != 0) {
+    return false;
+  }
+
+  // The target is the little-endian 32-bit number in its first four bytes.
+  char targetBytes[4];
+  if (!decodeHex(target.data, 8, targetBytes)) {
+    return false;
+  }
+
+  _job.blob.resize(blob.size / 2);
+  if (!decodeHex(blob.data, blob.size, _job.blob.data())) {
+    return false;
+  }
+
+  _job.jobId = QString::fromLatin1(jobId.data, jobId.size);
+  _job.target = static_cast<quint32>(static_cast<quint8>(targetBytes[0])) |
+    static_cast<quint32>(static_cast<quint8>(targetBytes[1])) << 8 |
+    static_cast<quint32>(static_cast<quint8>(targetBytes[2])) << 16 |
+    static_cast<quint32>(static_cast<quint8>(targetBytes[3])) << 24;
+  _job.generation = 0;
+  _job.nonce.reset();
+  _job.algorithm = HashAlgorithmRegistry::fromJob(
+    algorithm.data != nullptr ? QString::fromLatin1(algorithm.data, algorithm.size) : QString(),
+    variant.data != nullptr ? QString::fromLatin1(variant.data, variant.size) : QString(), _job.blob);
+  return true;
+}
+
+}
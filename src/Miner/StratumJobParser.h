@@ -0,0 +1,20 @@
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#pragma once
+
+#include <QtGlobal>
+
+namespace WalletGUI {
+
+struct Job;
+
+// Fast path for the most frequent Stratum message, the job notification
+// {"jsonrpc":"2.0","method":"job","params":{"blob":"...","job_id":"...","target":"...","algo":"..."}}.
+// Scans the raw line once and decodes job_id, blob and target straight into _job without building a
+// JSON or variant tree; the optional algo and variant fields, or else the blob version, select the
+// algorithm. Returns false for anything else, including job notifications it cannot decode exactly
+// (escaped strings, malformed hex); such lines should take the generic JSON path.
+bool parseJobNotification(const char* _data, int _size, Job& _job);
+
+}
@@ -0,0 +1,87 @@
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#include "TimerWheel.h"
+
+namespace WalletGUI {
+
+TimerWheel::TimerWheel(int _slotCount, qint64 _tickDuration) : m_slots(_slotCount), m_entrySlots(),
+  m_tickDuration(_tickDuration), m_lastTick(-1) {
+  Q_ASSERT(_slotCount > 0);
+  Q_ASSERT(_tickDuration > 0);
+}
+
+TimerWheel::~TimerWheel() {
+}
+
+qint64 TimerWheel::getTickDuration() const {
+  return m_tickDuration;
+}
+
+bool TimerWheel::isEmpty() const {
+  return m_entrySlots.isEmpty();
+}
+
+void TimerWheel::schedule(quint64 _id, qint64 _deadline) {
+  cancel(_id);
+  // Round up so that the deadline has passed by the time its tick is visited. A tick that has already
+  // been visited will not come round again for a whole revolution, so late deadlines go to the next
+  // slot in line.
+  const qint64 tick = qMax((_deadline + m_tickDuration - 1) / m_tickDuration, m_lastTick + 1);
+  const int slot = static_cast<int>(tick % m_slots.size());
+  m_slots[slot].append({_id, _deadline});
+  m_entrySlots.insert(_id, slot);
+}
+
+bool TimerWheel::cancel(quint64 _id) {
+  auto slotIt = m_entrySlots.find(_id);
+  if (slotIt == m_entrySlots.end()) {
+    return false;
+  }
+
+  QList<Entry>& entries = m_slots[slotIt.value()];
+  for (auto it = entries.begin(); it != entries.end(); ++it) {
+    if (it->id == _id) {
+      entries.erase(it);
+      break;
+    }
+  }
+
+  m_entrySlots.erase(slotIt);
+  return true;
+}
+
+QList<quint64> TimerWheel::advance(qint64 _now) {
+  QList<quint64> result;
+  const qint64 nowTick = _now / m_tickDuration;
+  if (nowTick <= m_lastTick) {
+    return result;
+  }
+
+  const qint64 firstTick = qMax(m_lastTick + 1, nowTick - m_slots.size() + 1);
+  for (qint64 tick = firstTick; tick <= nowTick; ++tick) {
+    QList<Entry>& entries = m_slots[static_cast<int>(tick % m_slots.size())];
+    for (auto it = entries.begin(); it != entries.end();) {
+      if (it->deadline <= _now) {
+        result.append(it->id);
+        m_entrySlots.remove(it->id);
+        it = entries.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+
+  m_lastTick = nowTick;
+  return result;
+}
+
+void TimerWheel::clear() {
+  for (QList<Entry>& entries : m_slots) {
+    entries.clear();
+  }
+
+  m_entrySlots.clear();
+}
+
+}
@@ -0,0 +1,44 @@
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#pragma once
+
+#include <QHash>
+#include <QList>
+#include <QVector>
+
+namespace WalletGUI {
+
+// Hashed timer wheel for many short deadlines keyed by id.
+//
+// A deadline lands in the slot of the first tick at or after it; advance() visits only the slots whose tick
+// has passed since the previous call and returns the ids that are due. Deadlines further away than one
+// revolution simply stay in their slot until a later pass. Scheduling and cancelling are O(1) on
+// average, so the owner can keep one deadline per outstanding request and drive the wheel from a
+// single periodic timer. Times are in the caller's units, typically nanoseconds.
+class TimerWheel {
+public:
+  TimerWheel(int _slotCount, qint64 _tickDuration);
+  ~TimerWheel();
+
+  qint64 getTickDuration() const;
+  bool isEmpty() const;
+
+  void schedule(quint64 _id, qint64 _deadline);
+  bool cancel(quint64 _id);
+  QList<quint64> advance(qint64 _now);
+  void clear();
+
+private:
+  struct Entry {
+    quint64 id;
+    qint64 deadline;
+  };
+
+  QVector<QList<Entry>> m_slots;
+  QHash<quint64, int> m_entrySlots;
+  const qint64 m_tickDuration;
+  qint64 m_lastTick;
+};
+
+}
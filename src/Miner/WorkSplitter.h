@@ -0,0 +1,43 @@
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#pragma once
+
+#include <QtGlobal>
+
+namespace WalletGUI {
+
+// Deficit scheduler deciding whether the next nonce batch of a worker goes to the main or to the
+// alternate account. Every round adds the alternate percentage to a credit and a round is handed to
+// the alternate account whenever the credit reaches 100, so any 100 consecutive rounds contain
+// exactly the configured number of alternate rounds. Owned by a single worker thread, no locking.
+class WorkSplitter {
+  Q_DISABLE_COPY(WorkSplitter)
+
+public:
+  static const quint32 SCALE = 100;
+
+  WorkSplitter() : m_percentage(0), m_credit(0) {
+  }
+
+  bool isNextAlternate(quint32 _percentage) {
+    if (Q_UNLIKELY(_percentage != m_percentage)) {
+      m_percentage = _percentage < SCALE ? _percentage : SCALE;
+      m_credit = 0;
+    }
+
+    m_credit += m_percentage;
+    if (m_credit < SCALE) {
+      return false;
+    }
+
+    m_credit -= SCALE;
+    return true;
+  }
+
+private:
+  quint32 m_percentage;
+  quint32 m_credit;
+};
+
+}
@@ -1,138 +1,269 @@
-// Copyright (c) 2015-2018, The Bytecoin developers.
-// Licensed under the GNU Lesser General Public License. See LICENSE for details.
-
-#include <QReadWriteLock>
-#include <QThread>
-
-#include "crypto/hash.hpp"
-
-#include "Worker.h"
-
-namespace WalletGUI {
-
-namespace  {
-  void miningRound(Job& _localJob, quint32& _localNonce, crypto::Hash& _hash, crypto::CryptoNightContext& _context) {
-    _localJob.blob.replace(39, sizeof(_localNonce), reinterpret_cast<char*>(&_localNonce), sizeof(_localNonce));
-    std::memset(&_hash, 0, sizeof(_hash));
-    //_hash = _context.cn_slow_hash(_localJob.blob.data(), _localJob.blob.size());
-    _hash = _context.cn_slow_hash_v1(_localJob.blob.data(), _localJob.blob.size());
-  }
-}
-
-Worker::Worker(Job& _mainJob, Job& _alternateJob,
-  QReadWriteLock& _mainJobLock, QReadWriteLock& _alternateJobLock,
-  std::atomic<quint32>& _mainNonce, std::atomic<quint32>& _alternateNonce, std::atomic<quint32>& _alternateProbability,
-  std::atomic<quint32>& _hashCounter, std::atomic<quint32>& _alternateHashCounter, QObject* _parent) : QObject(_parent),
-  m_mainJob(_mainJob), m_alternateJob(_alternateJob), m_mainJobLock(_mainJobLock), m_alternateJobLock(_alternateJobLock),
-  m_mainNonce(_mainNonce), m_alternateNonce(_alternateNonce), m_hashCounter(_hashCounter), m_alternateHashCounter(_alternateHashCounter),
-  m_alternateProbability(_alternateProbability), m_isStopped(true) {
-}
-
-Worker::~Worker() {
-}
-
-void Worker::start() {
-  m_isStopped = false;
-  QMetaObject::invokeMethod(this, "run", Qt::QueuedConnection);
-}
-
-void Worker::stop() {
-  m_isStopped = true;
-}
-
-void Worker::addObserver(IMinerWorkerObserver* _observer) {
-  QObject* observer = dynamic_cast<QObject*>(_observer);
-  m_observerConnections[_observer] << connect(this, SIGNAL(shareFoundSignal(QString, quint32, QByteArray)), observer,
-    SLOT(shareFound(QString, quint32, QByteArray)), Qt::QueuedConnection);
-}
-
-void Worker::removeObserver(IMinerWorkerObserver* _observer) {
-  if (!m_observerConnections.contains(_observer) || m_observerConnections.value(_observer).isEmpty()) {
-    return;
-  }
-
-  for (const auto& connection : m_observerConnections[_observer]) {
-    disconnect(connection);
-  }
-
-  m_observerConnections[_observer].clear();
-}
-
-void Worker::addAlternateObserver(IMinerWorkerObserver* _observer) {
-  QObject* observer = dynamic_cast<QObject*>(_observer);
-  m_alternateObserverConnections[_observer] << connect(this, SIGNAL(alternateShareFoundSignal(QString, quint32, QByteArray)),
-    observer, SLOT(shareFound(QString, quint32, QByteArray)), Qt::QueuedConnection);
-}
-
-void Worker::removeAlternateObserver(IMinerWorkerObserver* _observer) {
-  if (!m_alternateObserverConnections.contains(_observer) && m_alternateObserverConnections.value(_observer).isEmpty()) {
-    return;
-  }
-
-  for (const auto& connection : m_alternateObserverConnections[_observer]) {
-    disconnect(connection);
-  }
-
-  m_alternateObserverConnections[_observer].clear();
-}
-
-void Worker::run() {
-  Job localJob;
-  quint32 localNonce;
-  crypto::Hash hash;
-  crypto::CryptoNightContext context;
-  while (!m_isStopped) {
-    bool alternateObserverExists = !m_alternateJob.jobId.isEmpty();
-    if (m_alternateProbability == 0 || !alternateObserverExists) {
-      mainJobMiningRound(localJob, localNonce, hash, context);
-    } else if ((quint32)qrand() % 100 < m_alternateProbability) {
-      alternateJobMiningRound(localJob, localNonce, hash, context);
-    } else {
-      mainJobMiningRound(localJob, localNonce, hash, context);
-    }
-  }
-}
-
-void Worker::mainJobMiningRound(Job& _localJob, quint32& _localNonce, crypto::Hash& _hash, crypto::CryptoNightContext& _context) {
-  {
-    QReadLocker lock(&m_mainJobLock);
-    if (m_mainJob.jobId.isEmpty()) {
-      lock.unlock();
-      QThread::msleep(100);
-      return;
-    }
-
-    if (_localJob.jobId != m_mainJob.jobId) {
-      _localJob = m_mainJob;
-    }
-  }
-
-  _localNonce = ++m_mainNonce;
-  miningRound(_localJob, _localNonce, _hash, _context);
-  ++m_hashCounter;
-  if (Q_UNLIKELY(((quint32*)&_hash)[7] < _localJob.target)) {
-    Q_EMIT shareFoundSignal(_localJob.jobId, _localNonce, QByteArray(reinterpret_cast<char*>(&_hash), sizeof(_hash)));
-  }
-}
-
-void Worker::alternateJobMiningRound(Job& _localJob, quint32& _localNonce, crypto::Hash& _hash, crypto::CryptoNightContext& _context) {
-  {
-    QReadLocker lock(&m_alternateJobLock);
-    if (m_alternateJob.jobId.isEmpty()) {
-      return;
-    }
-
-    if (_localJob.jobId != m_alternateJob.jobId) {
-      _localJob = m_alternateJob;
-    }
-  }
-
-  _localNonce = ++m_alternateNonce;
-  miningRound(_localJob, _localNonce, _hash, _context);
-  ++m_alternateHashCounter;
-  if (Q_UNLIKELY(((quint32*)&_hash)[7] < _localJob.target)) {
-    Q_EMIT alternateShareFoundSignal(_localJob.jobId, _localNonce, QByteArray(reinterpret_cast<char*>(&_hash), sizeof(_hash)));
-  }
-}
-
-}
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#include <QThread>
+
+#include "crypto/hash.hpp"
+
+#include "CpuTopology.h"
+#include "CryptoNightKernel.h"
+#include "JobSlot.h"
+#include "ShareQueue.h"
+#include "Worker.h"
+#include "Trace/TraceRecorder.h"
+#include "logger.h"
+
+namespace WalletGUI {
+
+namespace  {
+  const int NONCE_OFFSET = 39;
+  const quint32 FULL_DUTY_CYCLE = 100;
+  const qint64 MIN_THROTTLE_SLEEP = 1000000;
+  const qint64 MAX_IDLE_DEBT = 1000000000;
+
+  static_assert(sizeof(crypto::Hash) == ShareRecord::HASH_SIZE, "Share records must hold a whole hash");
+
+  bool isShare(const crypto::Hash& _hash, quint32 _target) {
+    return reinterpret_cast<const quint32*>(&_hash)[7] < _target;
+  }
+}
+
+Worker::Worker(const WorkSource& _source, std::atomic<quint32>& _nonceBatchSize, std::atomic<quint32>& _dutyCycle,
+  std::atomic<quint64>& _noncePartition, QObject* _parent) : QObject(_parent),
+  m_source(_source), m_nonceBatchSize(_nonceBatchSize), m_dutyCycle(_dutyCycle),
+  m_noncePartition(_noncePartition), m_isStopped(true), m_cpu(-1), m_runMutex(), m_kernel(), m_kernelCpu(-1),
+  m_idlePriority(false), m_niceLevel(0), m_priorityChanged(false), m_hasCustomPriority(false), m_idleDebt(0), m_hashCounter(), m_workSplitter() {
+}
+
+Worker::~Worker() {
+}
+
+void Worker::start() {
+  m_isStopped = false;
+  QMetaObject::invokeMethod(this, "run", Qt::QueuedConnection);
+}
+
+void Worker::stop() {
+  m_isStopped = true;
+}
+
+void Worker::setCpu(int _cpu) {
+  m_cpu = _cpu;
+}
+
+// Applied by the worker thread itself at the start of its next round.
+void Worker::setPriority(const WorkerPriority& _priority) {
+  m_idlePriority = _priority.idle;
+  m_niceLevel = _priority.niceLevel;
+  m_priorityChanged = true;
+}
+
+quint64 Worker::getHashCount() const {
+  return m_hashCounter.getMainHashCount();
+}
+
+quint64 Worker::getAlternateHashCount() const {
+  return m_hashCounter.getAlternateHashCount();
+}
+
+void Worker::setWorkSource(const WorkSource& _source) {
+  Q_ASSERT(m_isStopped);
+  m_source = _source;
+}
+
+// run() holds m_runMutex for its whole duration, so once the lock is free after stop() the loop
+// has left its last round and no longer touches the previous work source.
+void Worker::waitForStopped() {
+  QMutexLocker locker(&m_runMutex);
+}
+
+// Queued behind a running loop, so the scratchpads are freed by the worker thread once it stops.
+void Worker::releaseScratchpads() {
+  QMetaObject::invokeMethod(this, "releaseKernel", Qt::QueuedConnection);
+}
+
+void Worker::run() {
+  QMutexLocker locker(&m_runMutex);
+  if (m_isStopped) {
+    return;
+  }
+
+  LocalJob mainJob;
+  LocalJob alternateJob;
+  mainJob.generation = 0;
+  mainJob.nonceCount = 0;
+  alternateJob.generation = 0;
+  alternateJob.nonceCount = 0;
+  // Pin before the kernel allocates its scratchpad so it is first touched on the target CPU's NUMA node.
+  const int cpu = m_cpu;
+  if (cpu >= 0 && !CpuTopology::pinCurrentThread(cpu)) {
+    WalletLogger::warning(QString("[Miner] Failed to pin worker thread to CPU %1").arg(cpu));
+  }
+
+  applyPriority();
+  CryptoNightKernel& kernel = prepareKernel(cpu);
+  m_idleDebt = 0;
+  m_roundTimer.start();
+  while (!m_isStopped) {
+    if (Q_UNLIKELY(m_priorityChanged.load(std::memory_order_relaxed))) {
+      applyPriority();
+    }
+
+    // Rounds without an alternate job are not counted by the splitter, so the configured ratio holds
+    // over the time both accounts actually have work.
+    const quint32 alternateProbability = *m_source.alternateProbability;
+    if (alternateProbability == 0 || !m_source.alternateJobSlot->hasJob()) {
+      mainJobMiningRound(mainJob, kernel);
+    } else if (m_workSplitter.isNextAlternate(alternateProbability)) {
+      alternateJobMiningRound(alternateJob, kernel);
+    } else {
+      mainJobMiningRound(mainJob, kernel);
+    }
+
+    throttle();
+  }
+}
+
+void Worker::releaseKernel() {
+  if (m_isStopped && m_kernel) {
+    m_kernel.reset();
+    WalletLogger::debug(QString("[Miner] Worker scratchpads released"));
+  }
+}
+
+// The kernel outlives a single run so that a pool switch, which only stops and restarts the loop,
+// keeps the scratchpad. It is reallocated when the worker moves to another CPU and should have its
+// scratchpad on that CPU's NUMA node.
+CryptoNightKernel& Worker::prepareKernel(int _cpu) {
+  if (m_kernel && m_kernelCpu == _cpu) {
+    return *m_kernel;
+  }
+
+  m_kernel.reset();
+  m_kernel.reset(new CryptoNightKernel);
+  m_kernelCpu = _cpu;
+  WalletLogger::debug(QString("[Miner] Worker scratchpad allocated: CPU %1").
+    arg(_cpu >= 0 ? QString::number(_cpu) : QString("any")));
+  return *m_kernel;
+}
+
+void Worker::mainJobMiningRound(LocalJob& _localJob, CryptoNightKernel& _kernel) {
+  if (!updateLocalJob(_localJob, *m_source.mainJobSlot)) {
+    QThread::msleep(100);
+    return;
+  }
+
+  miningRound(_localJob, _kernel);
+  m_hashCounter.addMainHashes(1);
+  if (Q_UNLIKELY(isShare(_localJob.hash, _localJob.job.target))) {
+    m_source.mainShareQueue->push(_localJob.generation, _localJob.roundNonce, &_localJob.hash);
+  }
+}
+
+void Worker::alternateJobMiningRound(LocalJob& _localJob, CryptoNightKernel& _kernel) {
+  if (!updateLocalJob(_localJob, *m_source.alternateJobSlot)) {
+    return;
+  }
+
+  miningRound(_localJob, _kernel);
+  m_hashCounter.addAlternateHashes(1);
+  if (Q_UNLIKELY(isShare(_localJob.hash, _localJob.job.target))) {
+    m_source.alternateShareQueue->push(_localJob.generation, _localJob.roundNonce, &_localJob.hash);
+  }
+}
+
+void Worker::miningRound(LocalJob& _localJob, CryptoNightKernel& _kernel) {
+  const quint32 nonce = nextNonce(_localJob);
+  _localJob.roundNonce = nonce;
+  _localJob.job.blob.replace(NONCE_OFFSET, sizeof(nonce), reinterpret_cast<const char*>(&nonce), sizeof(nonce));
+
+  // The stratum client only publishes jobs whose algorithm the kernel supports, so the switch cannot fail.
+  if (Q_UNLIKELY(_localJob.job.algorithm != _kernel.getAlgorithm())) {
+    _kernel.setAlgorithm(_localJob.job.algorithm);
+  }
+
+  _kernel.hash(_localJob.job.blob, _localJob.hash);
+}
+
+void Worker::applyPriority() {
+  m_priorityChanged = false;
+  const bool idle = m_idlePriority;
+  const int niceLevel = m_niceLevel;
+  // The thread starts with the default priority, so the call is only made for a non-default one or to
+  // undo an earlier change. Platforms where it isn't supported stay quiet unless one is configured.
+  const bool isCustomPriority = idle || niceLevel != 0;
+  if (!isCustomPriority && !m_hasCustomPriority) {
+    return;
+  }
+
+  if (!CpuTopology::setCurrentThreadPriority(idle, niceLevel)) {
+    WalletLogger::warning(QString("[Miner] Failed to set worker priority: %1, nice %2").
+      arg(idle ? "SCHED_IDLE" : "normal policy").arg(niceLevel));
+  }
+
+  m_hasCustomPriority = isCustomPriority;
+}
+
+// Keeps the busy share of the thread at the duty cycle by sleeping in proportion to the time spent
+// hashing. The owed idle time is carried over between rounds, so rounds much shorter than a scheduler
+// tick still add up to an exact ratio, and the time actually slept is subtracted to absorb oversleeping.
+void Worker::throttle() {
+  const quint32 dutyCycle = m_dutyCycle;
+  if (dutyCycle >= FULL_DUTY_CYCLE || dutyCycle == 0) {
+    m_idleDebt = 0;
+    m_roundTimer.restart();
+    return;
+  }
+
+  const qint64 busyTime = m_roundTimer.nsecsElapsed();
+  m_idleDebt = qMin(m_idleDebt + busyTime * (FULL_DUTY_CYCLE - dutyCycle) / dutyCycle, MAX_IDLE_DEBT);
+  if (m_idleDebt >= MIN_THROTTLE_SLEEP) {
+    m_roundTimer.restart();
+    QThread::usleep(static_cast<unsigned long>(m_idleDebt / 1000));
+    m_idleDebt -= m_roundTimer.nsecsElapsed();
+  }
+
+  m_roundTimer.restart();
+}
+
+// The generation check is a single atomic load of a rarely written cache line, cheap enough to do
+// every round so that a new job is picked up immediately. The blob is copied only when the
+// generation has actually changed.
+bool Worker::updateLocalJob(LocalJob& _localJob, const JobSlot& _jobSlot) {
+  quint64 generation = _jobSlot.getGeneration();
+  if (Q_LIKELY(generation == _localJob.generation)) {
+    return !_localJob.job.jobId.isEmpty();
+  }
+
+  TraceRecorder::addInstant("Worker::jobSwitch", "miner");
+  std::shared_ptr<const Job> job = _jobSlot.getJob();
+  _localJob.nonceCount = 0;
+  if (!job) {
+    _localJob.generation = generation;
+    _localJob.job = Job();
+    return false;
+  }
+
+  _localJob.generation = job->generation;
+  _localJob.job = *job;
+  return true;
+}
+
+// Hands out nonces from a contiguous range reserved with a single atomic operation, so the shared
+// counter is touched once per batch instead of once per hash. A job change resets nonceCount and
+// forces a fresh reservation from the new job's own counter. The counter only
+// walks this instance's share of the nonce space; the partition puts the instance id on top.
+quint32 Worker::nextNonce(LocalJob& _localJob) {
+  if (_localJob.nonceCount == 0) {
+    TraceRecorder::addInstant("Worker::nonceBatch", "miner");
+    const quint32 batchSize = m_nonceBatchSize;
+    _localJob.noncePartition = NoncePartition::unpack(m_noncePartition.load(std::memory_order_relaxed));
+    _localJob.nonce = _localJob.job.nonce->fetch_add(batchSize) + 1;
+    _localJob.nonceCount = batchSize;
+  }
+
+  --_localJob.nonceCount;
+  return _localJob.noncePartition.apply(_localJob.nonce++);
+}
+
+}
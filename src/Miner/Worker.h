@@ -1,65 +1,100 @@
-// Copyright (c) 2015-2018, The Bytecoin developers.
-// Licensed under the GNU Lesser General Public License. See LICENSE for details.
-
-#pragma once
-
-#include <QMap>
-#include <QMetaObject>
-#include <QMutex>
-#include <QObject>
-
-#include <atomic>
-
-#include "IMinerWorker.h"
-
-class QReadWriteLock;
-
-namespace crypto {
-  struct Hash;
-  class CryptoNightContext;
-}
-
-namespace WalletGUI {
-
-class Worker : public QObject, public IMinerWorker {
-  Q_OBJECT
-  Q_DISABLE_COPY(Worker)
-
-public:
-  Worker(Job& _mainJob, Job& _alternateJob, QReadWriteLock& _mainJobLock, QReadWriteLock& _alternateJobLock,
-    std::atomic<quint32>& _mainNonce, std::atomic<quint32>& _alternateNonce, std::atomic<quint32>& _alternateProbability,
-    std::atomic<quint32>& _hashCounter, std::atomic<quint32>& _alternateHashCounter, QObject* _parent);
-  ~Worker();
-
-  virtual void start() override;
-  virtual void stop() override;
-  virtual void addObserver(IMinerWorkerObserver* _observer) override;
-  virtual void removeObserver(IMinerWorkerObserver* _observer) override;
-  virtual void addAlternateObserver(IMinerWorkerObserver* _observer) override;
-  virtual void removeAlternateObserver(IMinerWorkerObserver* _observer) override;
-
-private:
-  Job& m_mainJob;
-  Job& m_alternateJob;
-  QReadWriteLock& m_mainJobLock;
-  QReadWriteLock& m_alternateJobLock;
-  std::atomic<quint32>& m_mainNonce;
-  std::atomic<quint32>& m_alternateNonce;
-  std::atomic<quint32>& m_hashCounter;
-  std::atomic<quint32>& m_alternateHashCounter;
-  std::atomic<quint32>& m_alternateProbability;
-  std::atomic<bool> m_isStopped;
-  QMutex m_alternateObserverMutex;
-  QMap<IMinerWorkerObserver*, QList<QMetaObject::Connection>> m_observerConnections;
-  QMap<IMinerWorkerObserver*, QList<QMetaObject::Connection>> m_alternateObserverConnections;
-
-  Q_INVOKABLE void run();
-  void mainJobMiningRound(Job& _localJob, quint32& _localNonce, crypto::Hash& _hash, crypto::CryptoNightContext& _context);
-  void alternateJobMiningRound(Job& _localJob, quint32& _localNonce, crypto::Hash& _hash, crypto::CryptoNightContext& _context);
-
-Q_SIGNALS:
-  void shareFoundSignal(const QString& _jobId, quint32 _nonce, const QByteArray& _result);
-  void alternateShareFoundSignal(const QString& _jobId, quint32 _nonce, const QByteArray& _result);
-};
-
-}
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#pragma once
+
+#include <QElapsedTimer>
+#include <QMutex>
+#include <QObject>
+
+#include <atomic>
+#include <memory>
+
+#include "crypto/hash.hpp"
+
+#include "CryptoNightKernel.h"
+#include "HashCounter.h"
+#include "IMinerWorker.h"
+#include "NoncePartition.h"
+#include "WorkSplitter.h"
+
+namespace WalletGUI {
+
+class JobSlot;
+class ShareQueue;
+
+// Job slots and share queues of the pool a worker is hashing for, together with the percentage of
+// rounds that go to the alternate account.
+struct WorkSource {
+  JobSlot* mainJobSlot;
+  JobSlot* alternateJobSlot;
+  ShareQueue* mainShareQueue;
+  ShareQueue* alternateShareQueue;
+  std::atomic<quint32>* alternateProbability;
+};
+
+class Worker : public QObject, public IMinerWorker {
+  Q_OBJECT
+  Q_DISABLE_COPY(Worker)
+
+public:
+  Worker(const WorkSource& _source, std::atomic<quint32>& _nonceBatchSize, std::atomic<quint32>& _dutyCycle,
+    std::atomic<quint64>& _noncePartition, QObject* _parent);
+  ~Worker();
+
+  virtual void start() override;
+  virtual void stop() override;
+  virtual void setCpu(int _cpu) override;
+  virtual void setPriority(const WorkerPriority& _priority) override;
+  virtual quint64 getHashCount() const override;
+  virtual quint64 getAlternateHashCount() const override;
+
+  // Only valid while the worker is stopped, i.e. after stop() and waitForStopped().
+  void setWorkSource(const WorkSource& _source);
+  void waitForStopped();
+  void releaseScratchpads();
+
+private:
+  // Worker-local copy of a job together with the nonce range reserved for it and the nonce and
+  // hash of the current round.
+  struct LocalJob {
+    quint64 generation;
+    Job job;
+    quint32 nonce;
+    quint32 nonceCount;
+    NoncePartition noncePartition;
+    quint32 roundNonce;
+    crypto::Hash hash;
+  };
+
+  WorkSource m_source;
+  std::atomic<quint32>& m_nonceBatchSize;
+  std::atomic<quint32>& m_dutyCycle;
+  std::atomic<quint64>& m_noncePartition;
+  std::atomic<bool> m_isStopped;
+  std::atomic<int> m_cpu;
+  QMutex m_runMutex;
+  std::unique_ptr<CryptoNightKernel> m_kernel;
+  int m_kernelCpu;
+  std::atomic<bool> m_idlePriority;
+  std::atomic<int> m_niceLevel;
+  std::atomic<bool> m_priorityChanged;
+  bool m_hasCustomPriority;
+  QElapsedTimer m_roundTimer;
+  qint64 m_idleDebt;
+  HashCounter m_hashCounter;
+  WorkSplitter m_workSplitter;
+
+  Q_INVOKABLE void run();
+  Q_INVOKABLE void releaseKernel();
+  CryptoNightKernel& prepareKernel(int _cpu);
+  void mainJobMiningRound(LocalJob& _localJob, CryptoNightKernel& _kernel);
+  void alternateJobMiningRound(LocalJob& _localJob, CryptoNightKernel& _kernel);
+  void miningRound(LocalJob& _localJob, CryptoNightKernel& _kernel);
+  bool updateLocalJob(LocalJob& _localJob, const JobSlot& _jobSlot);
+  quint32 nextNonce(LocalJob& _localJob);
+  void applyPriority();
+  void throttle();
+};
+
+}
@@ -0,0 +1,164 @@
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#include <QThread>
+
+#include "WorkerPool.h"
+#include "logger.h"
+
+namespace WalletGUI {
+
+namespace {
+
+const quint32 DEFAULT_NONCE_BATCH_SIZE = 256;
+const quint32 FULL_DUTY_CYCLE = 100;
+
+}
+
+WorkerPool::WorkerPool(QObject* _parent) : QObject(_parent), m_source(), m_isAttached(false), m_workerCount(1),
+  m_activeWorkerCount(0), m_nonceBatchSize(DEFAULT_NONCE_BATCH_SIZE), m_dutyCycle(FULL_DUTY_CYCLE),
+  m_noncePartition(NoncePartition().pack()), m_workerPriority({false, 0}) {
+}
+
+WorkerPool::~WorkerPool() {
+  for (auto& workerThread : m_workerThreadList) {
+    workerThread.second->stop();
+    workerThread.first->quit();
+  }
+
+  for (auto& workerThread : m_workerThreadList) {
+    workerThread.first->wait();
+    delete workerThread.second;
+  }
+}
+
+void WorkerPool::attach(const WorkSource& _source) {
+  if (isAttached(_source)) {
+    return;
+  }
+
+  stopWorkers();
+  m_source = _source;
+  m_isAttached = true;
+  for (quint32 i = 0; i < m_workerCount; ++i) {
+    startWorker(i);
+  }
+
+  m_activeWorkerCount = m_workerCount;
+}
+
+void WorkerPool::detach(const WorkSource& _source) {
+  if (!isAttached(_source)) {
+    return;
+  }
+
+  stopWorkers();
+  m_isAttached = false;
+}
+
+bool WorkerPool::isAttached(const WorkSource& _source) const {
+  return m_isAttached && m_source.mainJobSlot == _source.mainJobSlot;
+}
+
+quint32 WorkerPool::getActiveWorkerCount() const {
+  return m_activeWorkerCount;
+}
+
+QList<const IMinerWorker*> WorkerPool::getWorkers() const {
+  QList<const IMinerWorker*> result;
+  for (const auto& workerThread : m_workerThreadList) {
+    result.append(workerThread.second);
+  }
+
+  return result;
+}
+
+void WorkerPool::releaseScratchpads() {
+  for (quint32 i = m_activeWorkerCount; i < static_cast<quint32>(m_workerThreadList.size()); ++i) {
+    m_workerThreadList[i].second->releaseScratchpads();
+  }
+}
+
+// Grows or shrinks the pool without touching the pool connection. Surviving workers keep their
+// threads and scratchpads; removed ones finish the current round, exit on their own and free their
+// scratchpads, so shrinking never blocks.
+void WorkerPool::setWorkerCount(quint32 _workerCount) {
+  Q_ASSERT(_workerCount > 0);
+  m_workerCount = _workerCount;
+  if (!m_isAttached || _workerCount == m_activeWorkerCount) {
+    return;
+  }
+
+  for (quint32 i = m_activeWorkerCount; i < _workerCount; ++i) {
+    startWorker(i);
+  }
+
+  for (quint32 i = _workerCount; i < m_activeWorkerCount; ++i) {
+    m_workerThreadList[i].second->stop();
+    m_workerThreadList[i].second->releaseScratchpads();
+  }
+
+  WalletLogger::info(QString("[Miner] Worker count changed from %1 to %2").arg(m_activeWorkerCount).arg(_workerCount));
+  m_activeWorkerCount = _workerCount;
+}
+
+void WorkerPool::setNonceBatchSize(quint32 _nonceBatchSize) {
+  Q_ASSERT(_nonceBatchSize > 0);
+  m_nonceBatchSize = _nonceBatchSize;
+}
+
+void WorkerPool::setDutyCycle(quint32 _dutyCycle) {
+  Q_ASSERT(_dutyCycle > 0 && _dutyCycle <= FULL_DUTY_CYCLE);
+  m_dutyCycle = _dutyCycle;
+}
+
+void WorkerPool::setCpuPlacement(const QList<int>& _cpus) {
+  m_cpuPlacement = _cpus;
+}
+
+void WorkerPool::setWorkerPriority(const WorkerPriority& _priority) {
+  m_workerPriority = _priority;
+  for (const auto& workerThread : m_workerThreadList) {
+    workerThread.second->setPriority(_priority);
+  }
+}
+
+// Running workers pick the new partition up with their next nonce batch.
+void WorkerPool::setNoncePartition(const NoncePartition& _partition) {
+  m_noncePartition = _partition.pack();
+}
+
+// Threads are created on first use and kept running with an idle event loop between attachments.
+void WorkerPool::startWorker(quint32 _index) {
+  if (static_cast<quint32>(m_workerThreadList.size()) < _index + 1) {
+    Worker* worker = new Worker(m_source, m_nonceBatchSize, m_dutyCycle, m_noncePartition, nullptr);
+    QThread* thread = new QThread(this);
+    thread->setObjectName(QString("Miner worker %1").arg(_index));
+    worker->moveToThread(thread);
+    thread->start();
+    m_workerThreadList.append(qMakePair(thread, worker));
+  }
+
+  Worker* worker = m_workerThreadList[_index].second;
+  // A worker removed by a recent shrink may still be finishing its last round.
+  worker->waitForStopped();
+  worker->setWorkSource(m_source);
+  worker->setCpu(m_cpuPlacement.value(_index, -1));
+  worker->setPriority(m_workerPriority);
+  worker->start();
+}
+
+// Also waits for workers removed by a shrink that may still be in their last round for the source.
+void WorkerPool::stopWorkers() {
+  for (quint32 i = 0; i < m_activeWorkerCount; ++i) {
+    m_workerThreadList[i].second->stop();
+  }
+
+  for (const auto& workerThread : m_workerThreadList) {
+    workerThread.second->waitForStopped();
+  }
+
+  m_activeWorkerCount = 0;
+}
+
+}
@@ -0,0 +1,66 @@
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#pragma once
+
+#include <QList>
+#include <QObject>
+#include <QPair>
+
+#include <atomic>
+
+#include "IMinerWorker.h"
+#include "NoncePartition.h"
+#include "Worker.h"
+
+class QThread;
+
+namespace WalletGUI {
+
+// Mining threads shared by all configured pools. Threads and scratchpads live as long as the pool
+// does; switching pools only stops the hashing loops, points them at the job slots and share queues
+// of the new miner and starts them again. Everything here runs on the thread that owns the pool.
+class WorkerPool : public QObject {
+  Q_OBJECT
+  Q_DISABLE_COPY(WorkerPool)
+
+public:
+  explicit WorkerPool(QObject* _parent);
+  ~WorkerPool();
+
+  // Hands the workers to _source, taking them away from any other source. Returns once no worker
+  // touches the previous source any more.
+  void attach(const WorkSource& _source);
+  // Stops the workers if they are working for _source; afterwards _source may be destroyed.
+  void detach(const WorkSource& _source);
+  bool isAttached(const WorkSource& _source) const;
+
+  quint32 getActiveWorkerCount() const;
+  QList<const IMinerWorker*> getWorkers() const;
+  // Frees the scratchpads of idle workers; they are allocated again on the next attach.
+  void releaseScratchpads();
+
+  void setWorkerCount(quint32 _workerCount);
+  void setNonceBatchSize(quint32 _nonceBatchSize);
+  void setDutyCycle(quint32 _dutyCycle);
+  void setCpuPlacement(const QList<int>& _cpus);
+  void setWorkerPriority(const WorkerPriority& _priority);
+  void setNoncePartition(const NoncePartition& _partition);
+
+private:
+  QList<QPair<QThread*, Worker*> > m_workerThreadList;
+  WorkSource m_source;
+  bool m_isAttached;
+  quint32 m_workerCount;
+  quint32 m_activeWorkerCount;
+  std::atomic<quint32> m_nonceBatchSize;
+  std::atomic<quint32> m_dutyCycle;
+  std::atomic<quint64> m_noncePartition;
+  QList<int> m_cpuPlacement;
+  WorkerPriority m_workerPriority;
+
+  void startWorker(quint32 _index);
+  void stopWorkers();
+};
+
+}
@@ -1,79 +1,85 @@
-// Copyright (c) 2015-2018, The Bytecoin developers.
-// Licensed under the GNU Lesser General Public License. See LICENSE for details.
-
-#pragma once
-
-#include <QAbstractItemModel>
-
-#include "IMiningManager.h"
-
-namespace WalletGUI {
-
-class MinerModel : public QAbstractItemModel, public IMinerManagerObserver {
-  Q_OBJECT
-  Q_DISABLE_COPY(MinerModel)
-  Q_ENUMS(Columns)
-  Q_ENUMS(Roles)
-
-public:
-  enum Columns {
-    COLUMN_POOL_URL = 0, COLUMN_DIFFICULTY, COLUMN_GOOD_SHARES, COLUMN_BAD_SHARES,
-      COLUMN_CONNECTION_ERROR_COUNT, COLUMN_LAST_CONNECTION_ERROR_TIME, COLUMN_REMOVE, COLUMN_HASHRATE,
-  };
-
-  enum Roles {
-    ROLE_POOL_HOST = Qt::UserRole, ROLE_POOL_PORT, ROLE_DIFFICULTY, ROLE_GOOD_SHARES, ROLE_BAD_SHARES,
-      ROLE_CONNECTION_ERROR_COUNT, ROLE_LAST_CONNECTION_ERROR_TIME, ROLE_STATE, ROLE_START_MINER, ROLE_HASHRATE,
-  };
-
-  MinerModel(IMiningManager* _minerManager, QObject* _parent);
-  ~MinerModel();
-
-  // QAbstractItemModel
-  int columnCount(const QModelIndex& _parent = QModelIndex()) const override;
-  int rowCount(const QModelIndex& _parent = QModelIndex()) const override;
-  Qt::DropActions supportedDragActions() const override;
-  Qt::DropActions supportedDropActions() const override;
-  Qt::ItemFlags flags(const QModelIndex& _index) const override;
-  QVariant headerData(int _section, Qt::Orientation _orientation, int _role = Qt::DisplayRole) const override;
-  QVariant data(const QModelIndex& _index, int _role = Qt::DisplayRole) const override;
-  QModelIndex index(int _row, int _column, const QModelIndex& _parent = QModelIndex()) const override;
-  QModelIndex parent(const QModelIndex& _index) const override;
-  bool moveRows(const QModelIndex& _sourceParent, int _sourceRow, int _count, const QModelIndex& _destinationParent,
-    int _destinationChild) override;
-  bool removeRows(int _row, int _count, const QModelIndex& _parent = QModelIndex()) override;
-
-  // IMinerManagerObserver
-  Q_SLOT virtual void minersLoaded() override;
-  Q_SLOT virtual void minersUnloaded() override;
-  Q_SLOT virtual void miningStarted() override;
-  Q_SLOT virtual void miningStopped() override;
-  Q_SLOT virtual void activeMinerChanged(quintptr _minerIndex) override;
-  Q_SLOT virtual void schedulePolicyChanged(MiningPoolSwitchStrategy _schedulePolicy) override;
-  Q_SLOT virtual void cpuCoreCountChanged(quint32 _cpuCoreCount) override;
-  Q_SLOT virtual void minerAdded(quintptr _minerIndex) override;
-  Q_SLOT virtual void minerRemoved(quintptr _minerIndex) override;
-  Q_SLOT virtual void stateChanged(quintptr _minerIndex, int _newState) override;
-  Q_SLOT virtual void hashRateChanged(quintptr _minerIndex, quint32 _hashRate) override;
-  Q_SLOT virtual void alternateHashRateChanged(quintptr _minerIndex, quint32 _hashRate) override;
-  Q_SLOT virtual void difficultyChanged(quintptr _minerIndex, quint32 _difficulty) override;
-  Q_SLOT virtual void goodShareCountChanged(quintptr _minerIndex, quint32 _goodShareCount) override;
-  Q_SLOT virtual void goodAlternateShareCountChanged(quintptr _minerIndex, quint32 _goodShareCount) override;
-  Q_SLOT virtual void badShareCountChanged(quintptr _minerIndex, quint32 _badShareCount) override;
-  Q_SLOT virtual void connectionErrorCountChanged(quintptr _minerIndex, quint32 _connectionErrorCount) override;
-  Q_SLOT virtual void lastConnectionErrorTimeChanged(quintptr _minerIndex, const QDateTime& _lastConnectionErrorTime) override;
-
-protected:
-  virtual void timerEvent(QTimerEvent* _event) override;
-
-private:
-  IMiningManager* m_miningManager;
-  int m_lastConnectionErrorTimerId;
-  const int m_columnCount;
-
-  QVariant getDecorationRole(const QModelIndex& _index) const;
-  QVariant getDislayRole(const QModelIndex& _index) const;
-  QVariant getUserRoles(const QModelIndex& _index, int _role) const;
-};
-
-}
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#pragma once
+
+#include <QAbstractItemModel>
+
+#include "IMiningManager.h"
+
+namespace WalletGUI {
+
+class MinerModel : public QAbstractItemModel, public IMinerManagerObserver {
+  Q_OBJECT
+  Q_DISABLE_COPY(MinerModel)
+  Q_ENUMS(Columns)
+  Q_ENUMS(Roles)
+
+public:
+  enum Columns {
+    COLUMN_POOL_URL = 0, COLUMN_DIFFICULTY, COLUMN_GOOD_SHARES, COLUMN_BAD_SHARES, COLUMN_STALE_SHARES,
+      COLUMN_CONNECTION_ERROR_COUNT, COLUMN_LAST_CONNECTION_ERROR_TIME, COLUMN_REMOVE, COLUMN_HASHRATE,
+  };
+
+  enum Roles {
+    ROLE_POOL_HOST = Qt::UserRole, ROLE_POOL_PORT, ROLE_DIFFICULTY, ROLE_GOOD_SHARES, ROLE_BAD_SHARES,
+      ROLE_CONNECTION_ERROR_COUNT, ROLE_LAST_CONNECTION_ERROR_TIME, ROLE_STATE, ROLE_START_MINER, ROLE_HASHRATE,
+      ROLE_HASHRATE_60_SECONDS, ROLE_HASHRATE_15_MINUTES, ROLE_HASHRATE_EWMA, ROLE_WORKER_HASHRATES,
+      ROLE_STALE_SHARES, ROLE_STALE_SHARE_RATE, ROLE_SUBMIT_LATENCY_50, ROLE_SUBMIT_LATENCY_90, ROLE_SUBMIT_LATENCY_99,
+      ROLE_ALTERNATE_PROBABILITY, ROLE_ALTERNATE_HASH_SHARE,
+  };
+
+  MinerModel(IMiningManager* _minerManager, QObject* _parent);
+  ~MinerModel();
+
+  // QAbstractItemModel
+  int columnCount(const QModelIndex& _parent = QModelIndex()) const override;
+  int rowCount(const QModelIndex& _parent = QModelIndex()) const override;
+  Qt::DropActions supportedDragActions() const override;
+  Qt::DropActions supportedDropActions() const override;
+  Qt::ItemFlags flags(const QModelIndex& _index) const override;
+  QVariant headerData(int _section, Qt::Orientation _orientation, int _role = Qt::DisplayRole) const override;
+  QVariant data(const QModelIndex& _index, int _role = Qt::DisplayRole) const override;
+  QModelIndex index(int _row, int _column, const QModelIndex& _parent = QModelIndex()) const override;
+  QModelIndex parent(const QModelIndex& _index) const override;
+  bool moveRows(const QModelIndex& _sourceParent, int _sourceRow, int _count, const QModelIndex& _destinationParent,
+    int _destinationChild) override;
+  bool removeRows(int _row, int _count, const QModelIndex& _parent = QModelIndex()) override;
+
+  // IMinerManagerObserver
+  Q_SLOT virtual void minersLoaded() override;
+  Q_SLOT virtual void minersUnloaded() override;
+  Q_SLOT virtual void miningStarted() override;
+  Q_SLOT virtual void miningStopped() override;
+  Q_SLOT virtual void activeMinerChanged(quintptr _minerIndex) override;
+  Q_SLOT virtual void schedulePolicyChanged(MiningPoolSwitchStrategy _schedulePolicy) override;
+  Q_SLOT virtual void cpuCoreCountChanged(quint32 _cpuCoreCount) override;
+  Q_SLOT virtual void minerAdded(quintptr _minerIndex) override;
+  Q_SLOT virtual void minerRemoved(quintptr _minerIndex) override;
+  Q_SLOT virtual void stateChanged(quintptr _minerIndex, int _newState) override;
+  Q_SLOT virtual void hashRateChanged(quintptr _minerIndex, quint32 _hashRate) override;
+  Q_SLOT virtual void alternateHashRateChanged(quintptr _minerIndex, quint32 _hashRate) override;
+  Q_SLOT virtual void difficultyChanged(quintptr _minerIndex, quint32 _difficulty) override;
+  Q_SLOT virtual void goodShareCountChanged(quintptr _minerIndex, quint32 _goodShareCount) override;
+  Q_SLOT virtual void goodAlternateShareCountChanged(quintptr _minerIndex, quint32 _goodShareCount) override;
+  Q_SLOT virtual void badShareCountChanged(quintptr _minerIndex, quint32 _badShareCount) override;
+  Q_SLOT virtual void staleShareCountChanged(quintptr _minerIndex, quint32 _staleShareCount) override;
+  Q_SLOT virtual void connectionErrorCountChanged(quintptr _minerIndex, quint32 _connectionErrorCount) override;
+  Q_SLOT virtual void lastConnectionErrorTimeChanged(quintptr _minerIndex, const QDateTime& _lastConnectionErrorTime) override;
+
+protected:
+  virtual void timerEvent(QTimerEvent* _event) override;
+
+private:
+  IMiningManager* m_miningManager;
+  int m_lastConnectionErrorTimerId;
+  const int m_columnCount;
+
+  QVariant getDecorationRole(const QModelIndex& _index) const;
+  QVariant getDislayRole(const QModelIndex& _index) const;
+  QVariant getHashRateToolTip(const QModelIndex& _index) const;
+  QVariant getSubmitLatencyToolTip(const QModelIndex& _index) const;
+  QVariant getUserRoles(const QModelIndex& _index, int _role) const;
+};
+
+}
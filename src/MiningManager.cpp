@@ -1,346 +1,652 @@
-// Copyright (c) 2015-2018, The Bytecoin developers.
-// Licensed under the GNU Lesser General Public License. See LICENSE for details.
-
-#include <QDateTime>
-#include <QUrl>
-
-#include "MiningManager.h"
-#include "Miner/Miner.h"
-#include "settings.h"
-#include "logger.h"
-#include "walletmodel.h"
-
-namespace WalletGUI {
-
-MiningManager::MiningManager(QObject* _parent) :
-  QObject(_parent), walletModel_(nullptr), m_activeMinerIndex(-1) {
-}
-
-MiningManager::~MiningManager() {
-    stopMining();
-}
-
-void MiningManager::startMining() {
-  switchToNextPool();
-  Q_EMIT miningStartedSignal();
-}
-
-void MiningManager::stopMining() {
-  for (IPoolMiner* miner : m_miners) {
-    if (miner->getCurrentState() != IPoolMiner::STATE_STOPPED) {
-      miner->stop();
-    }
-  }
-
-  m_activeMinerIndex = -1;
-  Q_EMIT miningStoppedSignal();
-}
-
-MiningPoolSwitchStrategy MiningManager::getSchedulePolicy() const {
-  return Settings::instance().getMiningPoolSwitchStrategy();
-}
-
-quint32 MiningManager::getCpuCoreCount() const {
-  return Settings::instance().getMiningCpuCoreCount();
-}
-
-quintptr MiningManager::getMinerCount() const {
-  return m_miners.size();
-}
-
-IPoolMiner*MiningManager::getMiner(quintptr _minerIndex) const {
-  Q_ASSERT((int)_minerIndex < m_miners.size());
-  return m_miners.at(_minerIndex);
-}
-
-void MiningManager::setSchedulePolicy(MiningPoolSwitchStrategy _policy)
-{
-    Settings::instance().setMiningPoolSwitchStrategy(_policy);
-    Q_EMIT schedulePolicyChangedSignal(_policy);
-}
-
-void MiningManager::setCpuCoreCount(quint32 _cpuCoreCount) {
-  Settings::instance().setMiningCpuCoreCount(_cpuCoreCount);
-  Q_EMIT cpuCoreCountChangedSignal(_cpuCoreCount);
-}
-
-quintptr MiningManager::addMiner(const QString& _host, quint16 _port, quint32 _difficulty) {
-  addNewMiner(_host, _port, _difficulty);
-  saveMiners();
-  Q_EMIT minerAddedSignal(m_miners.size() - 1);
-  return m_miners.size() - 1;
-}
-
-void MiningManager::removeMiner(quintptr _minerIndex) {
-  Q_ASSERT((int)_minerIndex < m_miners.size());
-  IPoolMiner* miner = m_miners.takeAt(_minerIndex);
-  if (miner->getCurrentState() != IPoolMiner::STATE_STOPPED) {
-    miner->stop();
-  }
-
-  dynamic_cast<QObject*>(miner)->deleteLater();
-  saveMiners();
-  Q_EMIT minerRemovedSignal(_minerIndex);
-}
-
-void MiningManager::moveMiner(quintptr _fromIndex, quintptr _toIndex) {
-  m_miners.move(_fromIndex, _toIndex);
-  saveMiners();
-  updateActiveMinerIndex();
-}
-
-void MiningManager::restoreDefaultMinerList() {
-  Q_ASSERT(m_miners.isEmpty());
-  Settings::instance().restoreDefaultPoolList();
-  loadMiners();
-}
-
-
-void MiningManager::addObserver(IMinerManagerObserver* _observer) {
-  QObject* observer = dynamic_cast<QObject*>(_observer);
-  m_observerConnections[_observer] << connect(this, SIGNAL(minersLoadedSignal()), observer, SLOT(minersLoaded()));
-  m_observerConnections[_observer] << connect(this, SIGNAL(minersUnloadedSignal()), observer, SLOT(minersUnloaded()));
-  m_observerConnections[_observer] << connect(this, SIGNAL(miningStartedSignal()), observer, SLOT(miningStarted()));
-  m_observerConnections[_observer] << connect(this, SIGNAL(miningStoppedSignal()), observer, SLOT(miningStopped()));
-  m_observerConnections[_observer] << connect(this, SIGNAL(activeMinerChangedSignal(quintptr)), observer, SLOT(activeMinerChanged(quintptr)));
-  m_observerConnections[_observer] << connect(this, SIGNAL(schedulePolicyChangedSignal(MiningPoolSwitchStrategy)), observer, SLOT(schedulePolicyChanged(MiningPoolSwitchStrategy)));
-  m_observerConnections[_observer] << connect(this, SIGNAL(cpuCoreCountChangedSignal(quint32)), observer, SLOT(cpuCoreCountChanged(quint32)));
-  m_observerConnections[_observer] << connect(this, SIGNAL(minerAddedSignal(quintptr)), observer, SLOT(minerAdded(quintptr)));
-  m_observerConnections[_observer] << connect(this, SIGNAL(minerRemovedSignal(quintptr)), observer, SLOT(minerRemoved(quintptr)));
-  m_observerConnections[_observer] << connect(this, SIGNAL(stateChangedSignal(quintptr,int)), observer, SLOT(stateChanged(quintptr,int)));
-  m_observerConnections[_observer] << connect(this, SIGNAL(hashRateChangedSignal(quintptr,quint32)), observer, SLOT(hashRateChanged(quintptr,quint32)));
-  m_observerConnections[_observer] << connect(this, SIGNAL(alternateHashRateChangedSignal(quintptr,quint32)), observer, SLOT(alternateHashRateChanged(quintptr,quint32)));
-  m_observerConnections[_observer] << connect(this, SIGNAL(difficultyChangedSignal(quintptr,quint32)), observer, SLOT(difficultyChanged(quintptr,quint32)));
-  m_observerConnections[_observer] << connect(this, SIGNAL(goodShareCountChangedSignal(quintptr,quint32)), observer, SLOT(goodShareCountChanged(quintptr,quint32)));
-  m_observerConnections[_observer] << connect(this, SIGNAL(goodAlternateShareCountChangedSignal(quintptr,quint32)), observer, SLOT(goodAlternateShareCountChanged(quintptr,quint32)));
-  m_observerConnections[_observer] << connect(this, SIGNAL(badShareCountChangedSignal(quintptr,quint32)), observer, SLOT(badShareCountChanged(quintptr,quint32)));
-  m_observerConnections[_observer] << connect(this, SIGNAL(connectionErrorCountChangedSignal(quintptr,quint32)), observer, SLOT(connectionErrorCountChanged(quintptr,quint32)));
-  m_observerConnections[_observer] << connect(this, SIGNAL(lastConnectionErrorTimeChangedSignal(quintptr,QDateTime)), observer, SLOT(lastConnectionErrorTimeChanged(quintptr,QDateTime)));
-}
-
-void MiningManager::removeObserver(IMinerManagerObserver* _observer) {
-  if (!m_observerConnections.contains(_observer) || m_observerConnections.value(_observer).isEmpty()) {
-    return;
-  }
-
-  for (const auto& connection : m_observerConnections[_observer]) {
-    disconnect(connection);
-  }
-
-  m_observerConnections[_observer].clear();
-}
-
-void MiningManager::stateChanged(int _newState) {
-  MiningPoolSwitchStrategy policy = getSchedulePolicy();
-  switch (_newState) {
-  case IPoolMiner::STATE_ERROR:
-    WalletLogger::info("[MiningManager] Switching to next pool...");
-    switchToNextPool();
-    break;
-  case IPoolMiner::STATE_RUNNING: {
-    int activeMinerIndex = m_miners.indexOf(dynamic_cast<IPoolMiner*>(sender()));
-    if (policy == MiningPoolSwitchStrategy::FAILOVER) {
-      stopMinersWithLowPriority(activeMinerIndex);
-    } else {
-      stopOtherMiners(activeMinerIndex);
-    }
-
-    m_activeMinerIndex = activeMinerIndex;
-    Q_EMIT activeMinerChangedSignal(m_activeMinerIndex);
-    break;
-  }
-  }
-}
-
-void MiningManager::hashRateChanged(quint32 _hashRate) {
-  int minerIndex = m_miners.indexOf(dynamic_cast<IPoolMiner*>(sender()));
-  Q_EMIT hashRateChangedSignal(minerIndex, _hashRate);
-}
-
-void MiningManager::alternateHashRateChanged(quint32 _hashRate) {
-  int minerIndex = m_miners.indexOf(dynamic_cast<IPoolMiner*>(sender()));
-  Q_EMIT alternateHashRateChangedSignal(minerIndex, _hashRate);
-}
-
-void MiningManager::difficultyChanged(quint32 _difficulty) {
-  int minerIndex = m_miners.indexOf(dynamic_cast<IPoolMiner*>(sender()));
-  Q_EMIT difficultyChangedSignal(minerIndex, _difficulty);
-}
-
-void MiningManager::goodShareCountChanged(quint32 _goodShareCount) {
-  int minerIndex = m_miners.indexOf(dynamic_cast<IPoolMiner*>(sender()));
-  Q_EMIT goodShareCountChangedSignal(minerIndex, _goodShareCount);
-}
-
-void MiningManager::goodAlternateShareCountChanged(quint32 _goodShareCount) {
-  int minerIndex = m_miners.indexOf(dynamic_cast<IPoolMiner*>(sender()));
-  Q_EMIT goodAlternateShareCountChangedSignal(minerIndex, _goodShareCount);
-}
-
-void MiningManager::badShareCountChanged(quint32 _badShareCount) {
-  int minerIndex = m_miners.indexOf(dynamic_cast<IPoolMiner*>(sender()));
-  Q_EMIT badShareCountChangedSignal(minerIndex, _badShareCount);
-}
-
-void MiningManager::connectionErrorCountChanged(quint32 _connectionErrorCount) {
-  int minerIndex = m_miners.indexOf(dynamic_cast<IPoolMiner*>(sender()));
-  Q_EMIT connectionErrorCountChangedSignal(minerIndex, _connectionErrorCount);
-}
-
-void MiningManager::lastConnectionErrorTimeChanged(const QDateTime& _lastConnectionErrorTime) {
-  int minerIndex = m_miners.indexOf(dynamic_cast<IPoolMiner*>(sender()));
-  Q_EMIT lastConnectionErrorTimeChangedSignal(minerIndex, _lastConnectionErrorTime);
-}
-
-void MiningManager::connectedToWalletd() {
-  loadMiners();
-}
-
-void MiningManager::disconnectedFromWalletd() {
-  for (IPoolMiner* miner : m_miners) {
-    miner->removeObserver(this);
-    if (miner->getCurrentState() != Miner::STATE_STOPPED) {
-      miner->stop();
-    }
-
-    dynamic_cast<QObject*>(miner)->deleteLater();
-  }
-
-  m_miners.clear();
-  Q_EMIT minersUnloadedSignal();
-}
-
-void MiningManager::switchToNextPool() {
-  QList<quintptr> errorMinerIndexes = getErrorMiners();
-  if (errorMinerIndexes.size() == m_miners.size()) {
-    return;
-  }
-
-  QList<quintptr> stoppedMinerIndexes = getStoppedMiners();
-  if (stoppedMinerIndexes.isEmpty()) {
-    return;
-  }
-
-  MiningPoolSwitchStrategy policy = getSchedulePolicy();
-  int nextMinerIndex = -1;
-  switch (policy) {
-  case MiningPoolSwitchStrategy::FAILOVER:
-    nextMinerIndex = stoppedMinerIndexes.first();
-    break;
-  case MiningPoolSwitchStrategy::RANDOM: {
-    if (m_activeMinerIndex != -1) {
-      m_miners[m_activeMinerIndex]->stop();
-    }
-
-    nextMinerIndex = stoppedMinerIndexes.at(qrand() % stoppedMinerIndexes.size());
-    break;
-  }
-  }
-
-  m_activeMinerIndex = nextMinerIndex;
-  m_miners[m_activeMinerIndex]->start(getCpuCoreCount());
-  Q_EMIT activeMinerChangedSignal(m_activeMinerIndex);
-}
-
-void MiningManager::stopMinersWithLowPriority(int _minerIndex) {
-  if (_minerIndex == m_miners.size() - 1) {
-    return;
-  }
-
-  for (int i = _minerIndex + 1; i < m_miners.size(); ++i) {
-    if (m_miners[i]->getCurrentState() != IPoolMiner::STATE_STOPPED) {
-      m_miners[i]->stop();
-    }
-  }
-}
-
-void MiningManager::stopOtherMiners(int _minerIndex) {
-  for (int i = 0; i < m_miners.size(); ++i) {
-    if (i != _minerIndex && m_miners[i]->getCurrentState() != IPoolMiner::STATE_STOPPED) {
-      m_miners[i]->stop();
-    }
-  }
-}
-
-QList<quintptr> MiningManager::getStoppedMiners() const {
-  QList<quintptr> result;
-  for (int i = 0; i < m_miners.size(); ++i) {
-    if (m_miners[i]->getCurrentState() == IPoolMiner::STATE_STOPPED) {
-      result.append(i);
-    }
-  }
-
-  return result;
-}
-
-QList<quintptr> MiningManager::getErrorMiners() const {
-  QList<quintptr> result;
-  for (int i = 0; i < m_miners.size(); ++i) {
-    if (m_miners[i]->getCurrentState() == IPoolMiner::STATE_ERROR) {
-      result.append(i);
-    }
-  }
-
-  return result;
-}
-
-void MiningManager::updateActiveMinerIndex() {
-  m_activeMinerIndex = -1;
-  for (int i = 0; i < m_miners.size(); ++i) {
-    if (m_miners[i]->getCurrentState() == IPoolMiner::STATE_RUNNING) {
-      m_activeMinerIndex = i;
-      break;
-    }
-  }
-}
-
-void MiningManager::addNewMiner(const QString& _host, quint16 _port, quint32 _difficulty) {
-  Q_ASSERT(walletModel_ != nullptr);
-  Miner* miner = new Miner(_host, _port, _difficulty, walletModel_->getAddress(), "x", this);
-  miner->addObserver(this);
-  m_miners.append(miner);
-}
-
-void MiningManager::loadMiners() {
-  QStringList poolList = Settings::instance().getMiningPoolList();
-  for (const QString& pool : poolList) {
-    QStringList poolParamList = pool.split(":");
-    if (poolParamList.size() < 2) {
-      continue;
-    }
-
-    QUrl poolUrl = QUrl::fromUserInput(QString("%1:%2").arg(poolParamList[0]).arg(poolParamList[1]));
-    if (!poolUrl.isValid()) {
-      continue;
-    }
-
-    quint32 difficulty = 0;
-    if (poolParamList.size() >= 3) {
-      difficulty = poolParamList[2].toUInt();
-    }
-
-    addNewMiner(poolUrl.host(), poolUrl.port(), difficulty);
-  }
-
-  Q_EMIT minersLoadedSignal();
-}
-
-void MiningManager::saveMiners() {
-  QStringList minerList;
-  for (IPoolMiner* miner : m_miners) {
-    if (miner->getDifficulty() > 0) {
-      minerList << QString("%1:%2:%3").arg(miner->getPoolHost()).arg(miner->getPoolPort()).arg(miner->getDifficulty());
-    } else {
-      minerList << QString("%1:%2").arg(miner->getPoolHost()).arg(miner->getPoolPort());
-    }
-  }
-
-  Settings::instance().setMiningPoolList(minerList);
-}
-
-void MiningManager::setWalletModel(WalletModel* walletModel)
-{
-    walletModel_ = walletModel;
-}
-
-}
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#include <QDateTime>
+#include <QStringList>
+#include <QTimerEvent>
+#include <QUrl>
+
+#include <limits>
+
+#include "MiningManager.h"
+#include "Miner/CpuTopology.h"
+#include "Miner/Miner.h"
+#include "Miner/WorkerPool.h"
+#include "Metrics/MetricsWriter.h"
+#include "settings.h"
+#include "logger.h"
+
+namespace WalletGUI {
+
+namespace {
+
+const int POOL_PROBE_INTERVAL = 60000;
+const qint64 MIN_POOL_SWITCH_INTERVAL = 5 * 60 * 1000;
+const double MIN_POOL_SCORE_IMPROVEMENT_RATIO = 0.25;
+const double MIN_POOL_SCORE_IMPROVEMENT = 20;
+const double POOL_REJECT_RATE_PENALTY = 10;
+const double POOL_SUBMIT_DELAY_PENALTY = 1;
+const double MILLISECONDS_PER_SECOND = 1000;
+
+}
+
+MiningManager::MiningManager(QObject* _parent) :
+  QObject(_parent), m_login(), m_workerPool(new WorkerPool(this)), m_activeMinerIndex(-1), m_probeTimerId(-1),
+  m_standbyMiner(nullptr) {
+}
+
+MiningManager::~MiningManager() {
+    stopMining();
+}
+
+void MiningManager::startMining() {
+  configureWorkerPool();
+  for (IPoolMiner* miner : m_miners) {
+    configureAutoDifficulty(miner);
+  }
+
+  switchToNextPool();
+  updateProbeTimer();
+  Q_EMIT miningStartedSignal();
+}
+
+void MiningManager::stopMining() {
+  for (IPoolMiner* miner : m_miners) {
+    miner->cancelProbe();
+    if (miner->getCurrentState() != IPoolMiner::STATE_STOPPED) {
+      miner->stop();
+    }
+  }
+
+  m_activeMinerIndex = -1;
+  m_workerPool->releaseScratchpads();
+  updateProbeTimer();
+  updateStandby();
+  Q_EMIT miningStoppedSignal();
+}
+
+MiningPoolSwitchStrategy MiningManager::getSchedulePolicy() const {
+  return Settings::instance().getMiningPoolSwitchStrategy();
+}
+
+quint32 MiningManager::getCpuCoreCount() const {
+  return Settings::instance().getMiningCpuCoreCount();
+}
+
+quint32 MiningManager::getDutyCycle() const {
+  return Settings::instance().getMiningDutyCycle();
+}
+
+quintptr MiningManager::getMinerCount() const {
+  return m_miners.size();
+}
+
+IPoolMiner*MiningManager::getMiner(quintptr _minerIndex) const {
+  Q_ASSERT((int)_minerIndex < m_miners.size());
+  return m_miners.at(_minerIndex);
+}
+
+QString MiningManager::getLogin() const {
+  return m_login;
+}
+
+void MiningManager::setLogin(const QString& _login) {
+  m_login = _login;
+}
+
+void MiningManager::setSchedulePolicy(MiningPoolSwitchStrategy _policy)
+{
+    Settings::instance().setMiningPoolSwitchStrategy(_policy);
+    updateProbeTimer();
+    updateStandby();
+    Q_EMIT schedulePolicyChangedSignal(_policy);
+}
+
+// Applied right away: while mining, the worker pool grows or shrinks without reconnecting.
+void MiningManager::setCpuCoreCount(quint32 _cpuCoreCount) {
+  Settings::instance().setMiningCpuCoreCount(_cpuCoreCount);
+  m_workerPool->setCpuPlacement(getCpuPlacement());
+  m_workerPool->setWorkerCount(_cpuCoreCount);
+
+  Q_EMIT cpuCoreCountChangedSignal(_cpuCoreCount);
+}
+
+void MiningManager::setDutyCycle(quint32 _dutyCycle) {
+  Settings::instance().setMiningDutyCycle(_dutyCycle);
+  m_workerPool->setDutyCycle(getDutyCycle());
+}
+
+quintptr MiningManager::addMiner(const QString& _host, quint16 _port, quint32 _difficulty) {
+  addNewMiner(_host, _port, _difficulty);
+  saveMiners();
+  Q_EMIT minerAddedSignal(m_miners.size() - 1);
+  return m_miners.size() - 1;
+}
+
+void MiningManager::removeMiner(quintptr _minerIndex) {
+  Q_ASSERT((int)_minerIndex < m_miners.size());
+  IPoolMiner* miner = m_miners.takeAt(_minerIndex);
+  miner->cancelProbe();
+  miner->stopStandby();
+  if (miner->getCurrentState() != IPoolMiner::STATE_STOPPED) {
+    miner->stop();
+  }
+
+  if (miner == m_standbyMiner) {
+    m_standbyMiner = nullptr;
+  }
+
+  dynamic_cast<QObject*>(miner)->deleteLater();
+  saveMiners();
+  updateActiveMinerIndex();
+  updateStandby();
+  Q_EMIT minerRemovedSignal(_minerIndex);
+}
+
+void MiningManager::moveMiner(quintptr _fromIndex, quintptr _toIndex) {
+  m_miners.move(_fromIndex, _toIndex);
+  saveMiners();
+  updateActiveMinerIndex();
+  updateStandby();
+}
+
+void MiningManager::restoreDefaultMinerList() {
+  Q_ASSERT(m_miners.isEmpty());
+  Settings::instance().restoreDefaultPoolList();
+  loadMiners();
+}
+
+
+void MiningManager::addObserver(IMinerManagerObserver* _observer) {
+  QObject* observer = dynamic_cast<QObject*>(_observer);
+  m_observerConnections[_observer] << connect(this, SIGNAL(minersLoadedSignal()), observer, SLOT(minersLoaded()));
+  m_observerConnections[_observer] << connect(this, SIGNAL(minersUnloadedSignal()), observer, SLOT(minersUnloaded()));
+  m_observerConnections[_observer] << connect(this, SIGNAL(miningStartedSignal()), observer, SLOT(miningStarted()));
+  m_observerConnections[_observer] << connect(this, SIGNAL(miningStoppedSignal()), observer, SLOT(miningStopped()));
+  m_observerConnections[_observer] << connect(this, SIGNAL(activeMinerChangedSignal(quintptr)), observer, SLOT(activeMinerChanged(quintptr)));
+  m_observerConnections[_observer] << connect(this, SIGNAL(schedulePolicyChangedSignal(MiningPoolSwitchStrategy)), observer, SLOT(schedulePolicyChanged(MiningPoolSwitchStrategy)));
+  m_observerConnections[_observer] << connect(this, SIGNAL(cpuCoreCountChangedSignal(quint32)), observer, SLOT(cpuCoreCountChanged(quint32)));
+  m_observerConnections[_observer] << connect(this, SIGNAL(minerAddedSignal(quintptr)), observer, SLOT(minerAdded(quintptr)));
+  m_observerConnections[_observer] << connect(this, SIGNAL(minerRemovedSignal(quintptr)), observer, SLOT(minerRemoved(quintptr)));
+  m_observerConnections[_observer] << connect(this, SIGNAL(stateChangedSignal(quintptr,int)), observer, SLOT(stateChanged(quintptr,int)));
+  m_observerConnections[_observer] << connect(this, SIGNAL(hashRateChangedSignal(quintptr,quint32)), observer, SLOT(hashRateChanged(quintptr,quint32)));
+  m_observerConnections[_observer] << connect(this, SIGNAL(alternateHashRateChangedSignal(quintptr,quint32)), observer, SLOT(alternateHashRateChanged(quintptr,quint32)));
+  m_observerConnections[_observer] << connect(this, SIGNAL(difficultyChangedSignal(quintptr,quint32)), observer, SLOT(difficultyChanged(quintptr,quint32)));
+  m_observerConnections[_observer] << connect(this, SIGNAL(goodShareCountChangedSignal(quintptr,quint32)), observer, SLOT(goodShareCountChanged(quintptr,quint32)));
+  m_observerConnections[_observer] << connect(this, SIGNAL(goodAlternateShareCountChangedSignal(quintptr,quint32)), observer, SLOT(goodAlternateShareCountChanged(quintptr,quint32)));
+  m_observerConnections[_observer] << connect(this, SIGNAL(badShareCountChangedSignal(quintptr,quint32)), observer, SLOT(badShareCountChanged(quintptr,quint32)));
+  m_observerConnections[_observer] << connect(this, SIGNAL(staleShareCountChangedSignal(quintptr,quint32)), observer, SLOT(staleShareCountChanged(quintptr,quint32)));
+  m_observerConnections[_observer] << connect(this, SIGNAL(connectionErrorCountChangedSignal(quintptr,quint32)), observer, SLOT(connectionErrorCountChanged(quintptr,quint32)));
+  m_observerConnections[_observer] << connect(this, SIGNAL(lastConnectionErrorTimeChangedSignal(quintptr,QDateTime)), observer, SLOT(lastConnectionErrorTimeChanged(quintptr,QDateTime)));
+}
+
+void MiningManager::removeObserver(IMinerManagerObserver* _observer) {
+  if (!m_observerConnections.contains(_observer) || m_observerConnections.value(_observer).isEmpty()) {
+    return;
+  }
+
+  for (const auto& connection : m_observerConnections[_observer]) {
+    disconnect(connection);
+  }
+
+  m_observerConnections[_observer].clear();
+}
+
+void MiningManager::stateChanged(int _newState) {
+  MiningPoolSwitchStrategy policy = getSchedulePolicy();
+  switch (_newState) {
+  case IPoolMiner::STATE_ERROR:
+    WalletLogger::info("[MiningManager] Switching to next pool...");
+    switchToNextPool();
+    break;
+  case IPoolMiner::STATE_RUNNING: {
+    int activeMinerIndex = m_miners.indexOf(dynamic_cast<IPoolMiner*>(sender()));
+    if (policy == MiningPoolSwitchStrategy::FAILOVER) {
+      stopMinersWithLowPriority(activeMinerIndex);
+    } else {
+      stopOtherMiners(activeMinerIndex);
+    }
+
+    m_activeMinerIndex = activeMinerIndex;
+    updateStandby();
+    Q_EMIT activeMinerChangedSignal(m_activeMinerIndex);
+    break;
+  }
+  }
+}
+
+void MiningManager::hashRateChanged(quint32 _hashRate) {
+  int minerIndex = m_miners.indexOf(dynamic_cast<IPoolMiner*>(sender()));
+  Q_EMIT hashRateChangedSignal(minerIndex, _hashRate);
+}
+
+void MiningManager::alternateHashRateChanged(quint32 _hashRate) {
+  int minerIndex = m_miners.indexOf(dynamic_cast<IPoolMiner*>(sender()));
+  Q_EMIT alternateHashRateChangedSignal(minerIndex, _hashRate);
+}
+
+void MiningManager::difficultyChanged(quint32 _difficulty) {
+  int minerIndex = m_miners.indexOf(dynamic_cast<IPoolMiner*>(sender()));
+  Q_EMIT difficultyChangedSignal(minerIndex, _difficulty);
+}
+
+void MiningManager::goodShareCountChanged(quint32 _goodShareCount) {
+  int minerIndex = m_miners.indexOf(dynamic_cast<IPoolMiner*>(sender()));
+  Q_EMIT goodShareCountChangedSignal(minerIndex, _goodShareCount);
+}
+
+void MiningManager::goodAlternateShareCountChanged(quint32 _goodShareCount) {
+  int minerIndex = m_miners.indexOf(dynamic_cast<IPoolMiner*>(sender()));
+  Q_EMIT goodAlternateShareCountChangedSignal(minerIndex, _goodShareCount);
+}
+
+void MiningManager::badShareCountChanged(quint32 _badShareCount) {
+  int minerIndex = m_miners.indexOf(dynamic_cast<IPoolMiner*>(sender()));
+  Q_EMIT badShareCountChangedSignal(minerIndex, _badShareCount);
+}
+
+void MiningManager::staleShareCountChanged(quint32 _staleShareCount) {
+  int minerIndex = m_miners.indexOf(dynamic_cast<IPoolMiner*>(sender()));
+  Q_EMIT staleShareCountChangedSignal(minerIndex, _staleShareCount);
+}
+
+void MiningManager::connectionErrorCountChanged(quint32 _connectionErrorCount) {
+  int minerIndex = m_miners.indexOf(dynamic_cast<IPoolMiner*>(sender()));
+  Q_EMIT connectionErrorCountChangedSignal(minerIndex, _connectionErrorCount);
+}
+
+void MiningManager::lastConnectionErrorTimeChanged(const QDateTime& _lastConnectionErrorTime) {
+  int minerIndex = m_miners.indexOf(dynamic_cast<IPoolMiner*>(sender()));
+  Q_EMIT lastConnectionErrorTimeChangedSignal(minerIndex, _lastConnectionErrorTime);
+}
+
+void MiningManager::writeMetrics(MetricsWriter& _writer) const {
+  _writer.addMetric("gdoge_miner_hashrate", MetricsWriter::GAUGE, "Hash rate averaged over the last minute, in hashes per second.");
+  _writer.addMetric("gdoge_miner_alternate_hashrate", MetricsWriter::GAUGE, "Hash rate spent on the alternate account, in hashes per second.");
+  _writer.addMetric("gdoge_miner_state", MetricsWriter::GAUGE, "Miner state: 0 stopped, 1 running, 2 error.");
+  _writer.addMetric("gdoge_miner_difficulty", MetricsWriter::GAUGE, "Share difficulty of the current job.");
+  _writer.addMetric("gdoge_miner_shares_total", MetricsWriter::COUNTER, "Shares submitted to the pool, by pool verdict.");
+  _writer.addMetric("gdoge_miner_connection_errors_total", MetricsWriter::COUNTER, "Failed connections to the pool.");
+  _writer.addMetric("gdoge_stratum_connect_seconds", MetricsWriter::GAUGE, "Time to connect to the pool, as last measured.");
+  _writer.addMetric("gdoge_stratum_login_seconds", MetricsWriter::GAUGE, "Time to log in to the pool, as last measured.");
+  _writer.addMetric("gdoge_stratum_submit_latency_seconds", MetricsWriter::HISTOGRAM, "Time from submitting a share to the pool verdict.");
+  for (const IPoolMiner* miner : m_miners) {
+    const MetricLabels labels = {qMakePair(QString("pool"), QString("%1:%2").arg(miner->getPoolHost()).arg(miner->getPoolPort()))};
+    _writer.addSample("gdoge_miner_hashrate", miner->getAverageHashRate(HashRateWindow::SECONDS_60), labels);
+    _writer.addSample("gdoge_miner_alternate_hashrate", miner->getAlternateHashRate(), labels);
+    _writer.addSample("gdoge_miner_state", miner->getCurrentState(), labels);
+    _writer.addSample("gdoge_miner_difficulty", miner->getDifficulty(), labels);
+    MetricLabels shareLabels = labels;
+    shareLabels.append(qMakePair(QString("result"), QString("good")));
+    _writer.addSample("gdoge_miner_shares_total", miner->getGoodShareCount(), shareLabels);
+    shareLabels.last().second = "bad";
+    _writer.addSample("gdoge_miner_shares_total", miner->getBadShareCount(), shareLabels);
+    shareLabels.last().second = "stale";
+    _writer.addSample("gdoge_miner_shares_total", miner->getStaleShareCount(), shareLabels);
+    _writer.addSample("gdoge_miner_connection_errors_total", miner->getConnectionErrorCount(), labels);
+    const PoolLatency latency = miner->getPoolLatency();
+    if (latency.isMeasured) {
+      _writer.addSample("gdoge_stratum_connect_seconds", latency.connectTime / MILLISECONDS_PER_SECOND, labels);
+      _writer.addSample("gdoge_stratum_login_seconds", latency.loginTime / MILLISECONDS_PER_SECOND, labels);
+    }
+
+    _writer.addHistogram("gdoge_stratum_submit_latency_seconds", miner->getSubmitLatencyHistogram(), labels);
+  }
+}
+
+void MiningManager::unloadMiners() {
+  for (IPoolMiner* miner : m_miners) {
+    miner->removeObserver(this);
+    miner->cancelProbe();
+    miner->stopStandby();
+    if (miner->getCurrentState() != Miner::STATE_STOPPED) {
+      miner->stop();
+    }
+
+    dynamic_cast<QObject*>(miner)->deleteLater();
+  }
+
+  m_miners.clear();
+  m_standbyMiner = nullptr;
+  Q_EMIT minersUnloadedSignal();
+}
+
+void MiningManager::timerEvent(QTimerEvent* _event) {
+  if (_event->timerId() == m_probeTimerId) {
+    // Rank on the previous round of probes, which have had a full interval to finish.
+    rankPools();
+    probePools();
+    return;
+  }
+
+  QObject::timerEvent(_event);
+}
+
+void MiningManager::switchToNextPool() {
+  QList<quintptr> errorMinerIndexes = getErrorMiners();
+  if (errorMinerIndexes.size() == m_miners.size()) {
+    return;
+  }
+
+  QList<quintptr> stoppedMinerIndexes = getStoppedMiners();
+  if (stoppedMinerIndexes.isEmpty()) {
+    return;
+  }
+
+  // A logged in standby pool was picked by the same strategy and takes over without a reconnect.
+  int standbyMinerIndex = -1;
+  if (m_standbyMiner != nullptr && m_standbyMiner->isStandbyReady()) {
+    standbyMinerIndex = m_miners.indexOf(m_standbyMiner);
+    WalletLogger::info(tr("[MiningManager] Taking over standby pool %1:%2").arg(m_standbyMiner->getPoolHost()).
+      arg(m_standbyMiner->getPoolPort()));
+  }
+
+  MiningPoolSwitchStrategy policy = getSchedulePolicy();
+  int nextMinerIndex = -1;
+  switch (policy) {
+  case MiningPoolSwitchStrategy::FAILOVER:
+    nextMinerIndex = standbyMinerIndex != -1 ? standbyMinerIndex : stoppedMinerIndexes.first();
+    break;
+  case MiningPoolSwitchStrategy::RANDOM: {
+    if (m_activeMinerIndex != -1) {
+      m_miners[m_activeMinerIndex]->stop();
+    }
+
+    nextMinerIndex = standbyMinerIndex != -1 ? standbyMinerIndex : stoppedMinerIndexes.at(qrand() % stoppedMinerIndexes.size());
+    break;
+  }
+  case MiningPoolSwitchStrategy::LATENCY: {
+    if (m_activeMinerIndex != -1 && m_miners[m_activeMinerIndex]->getCurrentState() != IPoolMiner::STATE_STOPPED) {
+      m_miners[m_activeMinerIndex]->stop();
+    }
+
+    nextMinerIndex = standbyMinerIndex != -1 ? standbyMinerIndex : getFastestMiner(stoppedMinerIndexes);
+    break;
+  }
+  }
+
+  startMiner(nextMinerIndex);
+}
+
+void MiningManager::startMiner(int _minerIndex) {
+  if (m_miners[_minerIndex] == m_standbyMiner) {
+    m_standbyMiner = nullptr;
+  }
+
+  m_activeMinerIndex = _minerIndex;
+  m_poolSwitchTimer.start();
+  m_miners[m_activeMinerIndex]->start();
+  // A ready standby reports STATE_RUNNING from start() already, and stateChanged() has picked the next
+  // standby and announced the active pool. Otherwise that happens once the pool has logged in.
+  if (m_miners[m_activeMinerIndex]->getCurrentState() != IPoolMiner::STATE_RUNNING) {
+    Q_EMIT activeMinerChangedSignal(m_activeMinerIndex);
+  }
+}
+
+// The worker pool outlives pool switches, so its settings are applied once per mining session.
+void MiningManager::configureWorkerPool() {
+  m_workerPool->setNonceBatchSize(Settings::instance().getMiningNonceBatchSize());
+  m_workerPool->setCpuPlacement(getCpuPlacement());
+  m_workerPool->setWorkerPriority({Settings::instance().isMiningIdlePriorityEnabled(),
+    Settings::instance().getMiningNiceLevel()});
+  m_workerPool->setDutyCycle(getDutyCycle());
+  m_workerPool->setNoncePartition(NoncePartition(Settings::instance().getMiningNonceInstanceId(),
+    Settings::instance().getMiningNoncePartitionBits()));
+  m_workerPool->setWorkerCount(getCpuCoreCount());
+}
+
+void MiningManager::configureAutoDifficulty(IPoolMiner* _miner) {
+  if (Settings::instance().isMiningAutoDifficultyEnabled()) {
+    _miner->setAutoDifficulty(Settings::instance().getMiningSharesPerMinute(),
+      Settings::instance().getMiningDifficultyDriftThreshold());
+  } else {
+    _miner->setAutoDifficulty(0, 0);
+  }
+}
+
+void MiningManager::updateProbeTimer() {
+  const bool probing = getSchedulePolicy() == MiningPoolSwitchStrategy::LATENCY && m_activeMinerIndex != -1;
+  if (probing && m_probeTimerId == -1) {
+    m_probeTimerId = startTimer(POOL_PROBE_INTERVAL);
+    probePools();
+  } else if (!probing && m_probeTimerId != -1) {
+    killTimer(m_probeTimerId);
+    m_probeTimerId = -1;
+    for (IPoolMiner* miner : m_miners) {
+      miner->cancelProbe();
+    }
+  }
+}
+
+void MiningManager::probePools() {
+  for (int i = 0; i < m_miners.size(); ++i) {
+    if (i != m_activeMinerIndex && m_miners[i]->getCurrentState() == IPoolMiner::STATE_STOPPED) {
+      m_miners[i]->probe();
+    }
+  }
+}
+
+void MiningManager::rankPools() {
+  if (m_activeMinerIndex == -1 || m_miners[m_activeMinerIndex]->getCurrentState() != IPoolMiner::STATE_RUNNING ||
+    m_poolSwitchTimer.elapsed() < MIN_POOL_SWITCH_INTERVAL) {
+    return;
+  }
+
+  int bestMinerIndex = -1;
+  double bestScore = std::numeric_limits<double>::infinity();
+  for (int i = 0; i < m_miners.size(); ++i) {
+    double score = getPoolScore(i);
+    if (i != m_activeMinerIndex && m_miners[i]->getCurrentState() == IPoolMiner::STATE_STOPPED &&
+      !m_miners[i]->isProbing() && score < bestScore) {
+      bestMinerIndex = i;
+      bestScore = score;
+    }
+  }
+
+  // Hysteresis: move only for a clear, absolute and relative, improvement, and not more often than
+  // MIN_POOL_SWITCH_INTERVAL.
+  const double activeScore = getPoolScore(m_activeMinerIndex);
+  if (bestMinerIndex == -1 || activeScore - bestScore < MIN_POOL_SCORE_IMPROVEMENT ||
+    bestScore > activeScore * (1 - MIN_POOL_SCORE_IMPROVEMENT_RATIO)) {
+    return;
+  }
+
+  WalletLogger::info(tr("[MiningManager] Switching to faster pool %1:%2 (score %3 ms, current %4 ms)").
+    arg(m_miners[bestMinerIndex]->getPoolHost()).arg(m_miners[bestMinerIndex]->getPoolPort()).
+    arg(bestScore, 0, 'f', 1).arg(activeScore, 0, 'f', 1));
+  m_miners[m_activeMinerIndex]->stop();
+  startMiner(bestMinerIndex);
+}
+
+double MiningManager::getPoolScore(int _minerIndex) const {
+  // Connect plus login round trip in milliseconds, which every pool is measured by: the probes for the
+  // stopped pools and the last login for the active one. A pool that has acknowledged shares is also
+  // charged for the time its acknowledgements take beyond that round trip, and the sum is inflated by
+  // the share of rejected results.
+  const PoolLatency latency = m_miners[_minerIndex]->getPoolLatency();
+  if (!latency.isMeasured || latency.failedProbeCount > 0) {
+    return std::numeric_limits<double>::infinity();
+  }
+
+  const double submitDelay = latency.submitTime > latency.loginTime ? latency.submitTime - latency.loginTime : 0;
+  return (latency.connectTime + latency.loginTime + POOL_SUBMIT_DELAY_PENALTY * submitDelay) *
+    (1 + POOL_REJECT_RATE_PENALTY * latency.rejectRate);
+}
+
+int MiningManager::getFastestMiner(const QList<quintptr>& _minerIndexes) const {
+  // Pools that have not been measured yet keep their list order behind the measured ones.
+  int bestMinerIndex = _minerIndexes.first();
+  double bestScore = getPoolScore(bestMinerIndex);
+  for (quintptr minerIndex : _minerIndexes) {
+    double score = getPoolScore(minerIndex);
+    if (score < bestScore) {
+      bestMinerIndex = minerIndex;
+      bestScore = score;
+    }
+  }
+
+  return bestMinerIndex;
+}
+
+int MiningManager::getStandbyCandidate() const {
+  QList<quintptr> candidates = getStoppedMiners();
+  candidates.removeAll(m_activeMinerIndex);
+  if (candidates.isEmpty()) {
+    return -1;
+  }
+
+  switch (getSchedulePolicy()) {
+  case MiningPoolSwitchStrategy::FAILOVER:
+    break;
+  case MiningPoolSwitchStrategy::RANDOM: {
+    const int standbyMinerIndex = m_miners.indexOf(m_standbyMiner);
+    if (standbyMinerIndex != -1 && candidates.contains(standbyMinerIndex)) {
+      return standbyMinerIndex;
+    }
+
+    return candidates.at(qrand() % candidates.size());
+  }
+  case MiningPoolSwitchStrategy::LATENCY:
+    return getFastestMiner(candidates);
+  }
+
+  return candidates.first();
+}
+
+void MiningManager::updateStandby() {
+  IPoolMiner* standbyMiner = nullptr;
+  if (Settings::instance().isMiningHotStandbyEnabled() && m_activeMinerIndex != -1) {
+    const int standbyMinerIndex = getStandbyCandidate();
+    if (standbyMinerIndex != -1) {
+      standbyMiner = m_miners[standbyMinerIndex];
+    }
+  }
+
+  if (standbyMiner == m_standbyMiner) {
+    return;
+  }
+
+  if (m_standbyMiner != nullptr) {
+    m_standbyMiner->stopStandby();
+  }
+
+  m_standbyMiner = standbyMiner;
+  if (m_standbyMiner != nullptr) {
+    WalletLogger::debug(tr("[MiningManager] Keeping %1:%2 on standby").arg(m_standbyMiner->getPoolHost()).
+      arg(m_standbyMiner->getPoolPort()));
+    m_standbyMiner->startStandby();
+  }
+}
+
+QList<int> MiningManager::getCpuPlacement() const {
+  if (!Settings::instance().isMiningThreadPinningEnabled()) {
+    return QList<int>();
+  }
+
+  QList<int> placement = CpuTopology::instance().getPlacement(getCpuCoreCount(), Settings::instance().getMiningExcludedCpus());
+  QStringList cpus;
+  for (int cpu : placement) {
+    cpus << QString::number(cpu);
+  }
+
+  WalletLogger::debug(tr("[Mining] Worker CPU placement: %1").arg(cpus.join(", ")));
+  return placement;
+}
+
+void MiningManager::stopMinersWithLowPriority(int _minerIndex) {
+  if (_minerIndex == m_miners.size() - 1) {
+    return;
+  }
+
+  for (int i = _minerIndex + 1; i < m_miners.size(); ++i) {
+    if (m_miners[i]->getCurrentState() != IPoolMiner::STATE_STOPPED) {
+      m_miners[i]->stop();
+    }
+  }
+}
+
+void MiningManager::stopOtherMiners(int _minerIndex) {
+  for (int i = 0; i < m_miners.size(); ++i) {
+    if (i != _minerIndex && m_miners[i]->getCurrentState() != IPoolMiner::STATE_STOPPED) {
+      m_miners[i]->stop();
+    }
+  }
+}
+
+QList<quintptr> MiningManager::getStoppedMiners() const {
+  QList<quintptr> result;
+  for (int i = 0; i < m_miners.size(); ++i) {
+    if (m_miners[i]->getCurrentState() == IPoolMiner::STATE_STOPPED) {
+      result.append(i);
+    }
+  }
+
+  return result;
+}
+
+QList<quintptr> MiningManager::getErrorMiners() const {
+  QList<quintptr> result;
+  for (int i = 0; i < m_miners.size(); ++i) {
+    if (m_miners[i]->getCurrentState() == IPoolMiner::STATE_ERROR) {
+      result.append(i);
+    }
+  }
+
+  return result;
+}
+
+void MiningManager::updateActiveMinerIndex() {
+  m_activeMinerIndex = -1;
+  for (int i = 0; i < m_miners.size(); ++i) {
+    if (m_miners[i]->getCurrentState() == IPoolMiner::STATE_RUNNING) {
+      m_activeMinerIndex = i;
+      break;
+    }
+  }
+}
+
+void MiningManager::addNewMiner(const QString& _host, quint16 _port, quint32 _difficulty) {
+  Miner* miner = new Miner(*m_workerPool, _host, _port, _difficulty, m_login, "x", this);
+  miner->addObserver(this);
+  configureAutoDifficulty(miner);
+  m_miners.append(miner);
+}
+
+void MiningManager::loadMiners() {
+  QStringList poolList = Settings::instance().getMiningPoolList();
+  for (const QString& pool : poolList) {
+    QStringList poolParamList = pool.split(":");
+    if (poolParamList.size() < 2) {
+      continue;
+    }
+
+    QUrl poolUrl = QUrl::fromUserInput(QString("%1:%2").arg(poolParamList[0]).arg(poolParamList[1]));
+    if (!poolUrl.isValid()) {
+      continue;
+    }
+
+    quint32 difficulty = 0;
+    if (poolParamList.size() >= 3) {
+      difficulty = poolParamList[2].toUInt();
+    }
+
+    addNewMiner(poolUrl.host(), poolUrl.port(), difficulty);
+  }
+
+  Q_EMIT minersLoadedSignal();
+}
+
+void MiningManager::saveMiners() {
+  QStringList minerList;
+  for (IPoolMiner* miner : m_miners) {
+    if (miner->getDifficulty() > 0) {
+      minerList << QString("%1:%2:%3").arg(miner->getPoolHost()).arg(miner->getPoolPort()).arg(miner->getDifficulty());
+    } else {
+      minerList << QString("%1:%2").arg(miner->getPoolHost()).arg(miner->getPoolPort());
+    }
+  }
+
+  Settings::instance().setMiningPoolList(minerList);
+}
+
+}
@@ -0,0 +1,369 @@
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#include <QDataStream>
+#include <QDateTime>
+#include <QJsonDocument>
+#include <QJsonParseError>
+#include <QPointer>
+#include <QTcpServer>
+#include <QTcpSocket>
+#include <QTimer>
+#include <QTimerEvent>
+
+#include "MockStratumServer.h"
+
+namespace WalletGUI {
+
+namespace {
+
+const QString JSON_RPC_TAG_NAME_ID = "id";
+const QString JSON_RPC_TAG_NAME_ERROR = "error";
+const QString JSON_RPC_TAG_NAME_CODE = "code";
+const QString JSON_RPC_TAG_NAME_MESSAGE = "message";
+const QString JSON_RPC_TAG_NAME_METHOD = "method";
+const QString JSON_RPC_TAG_NAME_PARAMS = "params";
+const QString JSON_RPC_TAG_NAME_RESULT = "result";
+const QString JSON_RPC_TAG_NAME_JSONRPC = "jsonrpc";
+
+const QString STRATUM_METHOD_NAME_LOGIN = "login";
+const QString STRATUM_METHOD_NAME_JOB = "job";
+const QString STRATUM_METHOD_NAME_SUBMIT = "submit";
+const QString STRATUM_LOGIN_PARAM_NAME_LOGIN = "login";
+const QString STRATUM_LOGIN_PARAM_NAME_SESSION_ID = "id";
+const QString STRATUM_LOGIN_PARAM_NAME_STATUS = "status";
+const QString STRATUM_LOGIN_PARAM_NAME_JOB = "job";
+const QString STRATUM_JOB_PARAM_NAME_JOB_BLOB = "blob";
+const QString STRATUM_JOB_PARAM_NAME_JOB_ID = "job_id";
+const QString STRATUM_JOB_PARAM_NAME_JOB_TARGET = "target";
+const QString STRATUM_SUBMIT_PARAM_NAME_JOB_ID = STRATUM_JOB_PARAM_NAME_JOB_ID;
+
+// Block hashing blob: varint major and minor versions, varint timestamp, previous block hash, nonce,
+// then the transaction tree root and a varint transaction count. A current timestamp always takes
+// five varint bytes, which puts the nonce at the offset the miner expects.
+const quint8 BLOB_MAJOR_VERSION = 1;
+const quint8 BLOB_MINOR_VERSION = 0;
+const int TIMESTAMP_VARINT_SIZE = 5;
+const int HASH_SIZE = 32;
+const int NONCE_OFFSET = 2 + TIMESTAMP_VARINT_SIZE + HASH_SIZE;
+const int BLOB_SIZE = NONCE_OFFSET + 4 + HASH_SIZE + 1;
+const int ERROR_CODE_INVALID_REQUEST = -32600;
+const int ERROR_CODE_METHOD_NOT_FOUND = -32601;
+const int ERROR_CODE_POOL = -1;
+
+QByteArray makeRandomHash() {
+  QByteArray hash(HASH_SIZE, 0);
+  for (int i = 0; i < HASH_SIZE; ++i) {
+    hash[i] = static_cast<char>(qrand() & 0xff);
+  }
+
+  return hash;
+}
+
+void appendVarint(QByteArray& _blob, quint64 _value) {
+  while (_value >= 0x80) {
+    _blob.append(static_cast<char>((_value & 0x7f) | 0x80));
+    _value >>= 7;
+  }
+
+  _blob.append(static_cast<char>(_value));
+}
+
+QByteArray makeTarget(quint32 _difficulty) {
+  QByteArray target;
+  QDataStream targetStream(&target, QIODevice::WriteOnly);
+  targetStream.setByteOrder(QDataStream::LittleEndian);
+  targetStream << static_cast<quint32>(0xffffffff / qMax<quint32>(_difficulty, 1));
+  return target.toHex();
+}
+
+// A "<address>.<difficulty>" login selects a fixed difficulty, like most pools do.
+quint32 parseLoginDifficulty(const QString& _login, quint32 _defaultDifficulty) {
+  const int separator = _login.lastIndexOf('.');
+  if (separator == -1) {
+    return _defaultDifficulty;
+  }
+
+  bool ok = false;
+  const quint32 difficulty = _login.mid(separator + 1).toUInt(&ok);
+  return ok && difficulty > 0 ? difficulty : _defaultDifficulty;
+}
+
+}
+
+MockStratumServer::MockStratumServer(const MockPoolBehavior& _behavior, QObject* _parent) : QObject(_parent),
+  m_behavior(_behavior), m_server(new QTcpServer(this)), m_previousBlockHash(makeRandomHash()), m_blockHeight(1),
+  m_sessionCounter(0), m_connectionCount(0), m_loginCount(0), m_jobCount(0), m_blockCount(0), m_submitCount(0),
+  m_acceptedShareCount(0), m_rejectedShareCount(0), m_droppedResponseCount(0), m_errorReplyCount(0),
+  m_forcedDisconnectCount(0), m_jobTimerId(-1), m_blockTimerId(-1), m_vardiffTimerId(-1), m_disconnectTimerId(-1) {
+  connect(m_server, &QTcpServer::newConnection, this, &MockStratumServer::newConnection);
+}
+
+MockStratumServer::~MockStratumServer() {
+}
+
+bool MockStratumServer::listen(const QHostAddress& _address, quint16 _port) {
+  if (!m_server->listen(_address, _port)) {
+    return false;
+  }
+
+  if (m_behavior.jobIntervalMsecs > 0) {
+    m_jobTimerId = startTimer(m_behavior.jobIntervalMsecs, Qt::PreciseTimer);
+  }
+
+  if (m_behavior.blockIntervalMsecs > 0) {
+    m_blockTimerId = startTimer(m_behavior.blockIntervalMsecs, Qt::PreciseTimer);
+  }
+
+  if (m_behavior.vardiffIntervalMsecs > 0) {
+    m_vardiffTimerId = startTimer(m_behavior.vardiffIntervalMsecs);
+  }
+
+  if (m_behavior.disconnectIntervalMsecs > 0) {
+    m_disconnectTimerId = startTimer(m_behavior.disconnectIntervalMsecs);
+  }
+
+  return true;
+}
+
+quint16 MockStratumServer::getPort() const {
+  return m_server->serverPort();
+}
+
+QString MockStratumServer::getErrorString() const {
+  return m_server->errorString();
+}
+
+QJsonObject MockStratumServer::getStatistics() const {
+  QJsonObject statistics;
+  statistics.insert("sessions", m_sessions.size());
+  statistics.insert("connections", static_cast<int>(m_connectionCount));
+  statistics.insert("logins", static_cast<int>(m_loginCount));
+  statistics.insert("jobs", static_cast<int>(m_jobCount));
+  statistics.insert("blocks", static_cast<int>(m_blockCount));
+  statistics.insert("submits", static_cast<int>(m_submitCount));
+  statistics.insert("accepted", static_cast<int>(m_acceptedShareCount));
+  statistics.insert("rejected", static_cast<int>(m_rejectedShareCount));
+  statistics.insert("dropped_responses", static_cast<int>(m_droppedResponseCount));
+  statistics.insert("error_replies", static_cast<int>(m_errorReplyCount));
+  statistics.insert("forced_disconnects", static_cast<int>(m_forcedDisconnectCount));
+  return statistics;
+}
+
+void MockStratumServer::timerEvent(QTimerEvent* _event) {
+  if (_event->timerId() == m_jobTimerId) {
+    for (QTcpSocket* socket : m_sessions.keys()) {
+      sendJobNotification(socket);
+    }
+
+    return;
+  } else if (_event->timerId() == m_blockTimerId) {
+    newBlock();
+    return;
+  } else if (_event->timerId() == m_vardiffTimerId) {
+    // Walk every session through doubling difficulties up to the maximum and back to the start.
+    for (QTcpSocket* socket : m_sessions.keys()) {
+      Session& session = m_sessions[socket];
+      session.difficulty = session.difficulty * 2 > m_behavior.maxDifficulty ? m_behavior.difficulty : session.difficulty * 2;
+      sendJobNotification(socket);
+    }
+
+    return;
+  } else if (_event->timerId() == m_disconnectTimerId) {
+    for (QTcpSocket* socket : m_sessions.keys()) {
+      ++m_forcedDisconnectCount;
+      socket->abort();
+    }
+
+    return;
+  }
+
+  QObject::timerEvent(_event);
+}
+
+// Jobs sent from now on build on the new block, which makes every job sent before it stale.
+void MockStratumServer::newBlock() {
+  ++m_blockCount;
+  ++m_blockHeight;
+  m_previousBlockHash = makeRandomHash();
+  for (QTcpSocket* socket : m_sessions.keys()) {
+    sendJobNotification(socket);
+  }
+}
+
+void MockStratumServer::newConnection() {
+  while (QTcpSocket* socket = m_server->nextPendingConnection()) {
+    ++m_connectionCount;
+    m_sessions.insert(socket, {QString(), m_behavior.difficulty, 0, QString(), QString(), 0});
+    connect(socket, &QTcpSocket::readyRead, this, [this, socket]() { readyRead(socket); });
+    connect(socket, &QTcpSocket::disconnected, this, [this, socket]() { disconnected(socket); });
+  }
+}
+
+void MockStratumServer::readyRead(QTcpSocket* _socket) {
+  while (_socket->canReadLine()) {
+    const QByteArray line = _socket->readLine().trimmed();
+    if (line.isEmpty()) {
+      continue;
+    }
+
+    QJsonParseError parseError;
+    const QJsonDocument request = QJsonDocument::fromJson(line, &parseError);
+    if (parseError.error != QJsonParseError::NoError || !request.isObject()) {
+      sendError(_socket, QJsonValue(), ERROR_CODE_INVALID_REQUEST, parseError.errorString());
+      continue;
+    }
+
+    processRequest(_socket, request.object());
+  }
+}
+
+void MockStratumServer::disconnected(QTcpSocket* _socket) {
+  m_sessions.remove(_socket);
+  _socket->deleteLater();
+}
+
+void MockStratumServer::processRequest(QTcpSocket* _socket, const QJsonObject& _request) {
+  const QString method = _request.value(JSON_RPC_TAG_NAME_METHOD).toString();
+  const QJsonValue id = _request.value(JSON_RPC_TAG_NAME_ID);
+  const QJsonObject params = _request.value(JSON_RPC_TAG_NAME_PARAMS).toObject();
+  if (method == STRATUM_METHOD_NAME_LOGIN) {
+    processLogin(_socket, id, params);
+  } else if (method == STRATUM_METHOD_NAME_SUBMIT) {
+    processSubmit(_socket, id, params);
+  } else {
+    sendError(_socket, id, ERROR_CODE_METHOD_NOT_FOUND, QString("Unknown method: %1").arg(method));
+  }
+}
+
+void MockStratumServer::processLogin(QTcpSocket* _socket, const QJsonValue& _id, const QJsonObject& _params) {
+  ++m_loginCount;
+  if (m_behavior.rejectLogin) {
+    sendError(_socket, _id, ERROR_CODE_POOL, "Login rejected");
+    return;
+  }
+
+  Session& session = m_sessions[_socket];
+  session.sessionId = QString::number(++m_sessionCounter);
+  session.difficulty = parseLoginDifficulty(_params.value(STRATUM_LOGIN_PARAM_NAME_LOGIN).toString(), m_behavior.difficulty);
+  QJsonObject result;
+  result.insert(STRATUM_LOGIN_PARAM_NAME_SESSION_ID, session.sessionId);
+  result.insert(STRATUM_LOGIN_PARAM_NAME_JOB, makeJob(session));
+  result.insert(STRATUM_LOGIN_PARAM_NAME_STATUS, QString("OK"));
+  sendResult(_socket, _id, result);
+}
+
+void MockStratumServer::processSubmit(QTcpSocket* _socket, const QJsonValue& _id, const QJsonObject& _params) {
+  ++m_submitCount;
+  const Session& session = m_sessions[_socket];
+  const QString jobId = _params.value(STRATUM_SUBMIT_PARAM_NAME_JOB_ID).toString();
+  if (session.sessionId.isEmpty()) {
+    ++m_rejectedShareCount;
+    sendError(_socket, _id, ERROR_CODE_POOL, "Unauthenticated");
+    return;
+  }
+
+  if (jobId.isEmpty() || (jobId != session.currentJobId && jobId != session.previousJobId)) {
+    ++m_rejectedShareCount;
+    sendError(_socket, _id, ERROR_CODE_POOL, "Block expired");
+    return;
+  }
+
+  ++m_acceptedShareCount;
+  QJsonObject result;
+  result.insert(STRATUM_LOGIN_PARAM_NAME_STATUS, QString("OK"));
+  sendResult(_socket, _id, result);
+}
+
+QJsonObject MockStratumServer::makeJob(Session& _session) {
+  // A fresh tree root per job stands in for the extra nonce a real pool puts into the coinbase.
+  QByteArray blob;
+  blob.reserve(BLOB_SIZE);
+  blob.append(static_cast<char>(BLOB_MAJOR_VERSION));
+  blob.append(static_cast<char>(BLOB_MINOR_VERSION));
+  appendVarint(blob, qMax<quint64>(QDateTime::currentMSecsSinceEpoch() / 1000, quint64(1) << 28));
+  blob.append(m_previousBlockHash);
+  Q_ASSERT(blob.size() == NONCE_OFFSET);
+  blob.append(QByteArray(4, 0));
+  blob.append(makeRandomHash());
+  appendVarint(blob, 1);
+  Q_ASSERT(blob.size() == BLOB_SIZE);
+
+  ++m_jobCount;
+  _session.previousJobId = _session.blockHeight == m_blockHeight ? _session.currentJobId : QString();
+  _session.blockHeight = m_blockHeight;
+  _session.currentJobId = QString("%1-%2").arg(_session.sessionId).arg(++_session.jobCounter);
+  QJsonObject job;
+  job.insert(STRATUM_JOB_PARAM_NAME_JOB_BLOB, QString::fromLatin1(blob.toHex()));
+  job.insert(STRATUM_JOB_PARAM_NAME_JOB_ID, _session.currentJobId);
+  job.insert(STRATUM_JOB_PARAM_NAME_JOB_TARGET, QString::fromLatin1(makeTarget(_session.difficulty)));
+  return job;
+}
+
+void MockStratumServer::sendJobNotification(QTcpSocket* _socket) {
+  Session& session = m_sessions[_socket];
+  if (session.sessionId.isEmpty()) {
+    return;
+  }
+
+  QJsonObject notification;
+  notification.insert(JSON_RPC_TAG_NAME_JSONRPC, QString("2.0"));
+  notification.insert(JSON_RPC_TAG_NAME_METHOD, STRATUM_METHOD_NAME_JOB);
+  notification.insert(JSON_RPC_TAG_NAME_PARAMS, makeJob(session));
+  write(_socket, notification);
+}
+
+void MockStratumServer::sendResult(QTcpSocket* _socket, const QJsonValue& _id, const QJsonObject& _result) {
+  if (roll(m_behavior.errorReplyPercent)) {
+    ++m_errorReplyCount;
+    sendError(_socket, _id, ERROR_CODE_POOL, "Scripted error reply");
+    return;
+  }
+
+  QJsonObject response;
+  response.insert(JSON_RPC_TAG_NAME_ID, _id);
+  response.insert(JSON_RPC_TAG_NAME_JSONRPC, QString("2.0"));
+  response.insert(JSON_RPC_TAG_NAME_ERROR, QJsonValue());
+  response.insert(JSON_RPC_TAG_NAME_RESULT, _result);
+  sendResponse(_socket, response);
+}
+
+void MockStratumServer::sendError(QTcpSocket* _socket, const QJsonValue& _id, int _code, const QString& _message) {
+  QJsonObject error;
+  error.insert(JSON_RPC_TAG_NAME_CODE, _code);
+  error.insert(JSON_RPC_TAG_NAME_MESSAGE, _message);
+  QJsonObject response;
+  response.insert(JSON_RPC_TAG_NAME_ID, _id);
+  response.insert(JSON_RPC_TAG_NAME_JSONRPC, QString("2.0"));
+  response.insert(JSON_RPC_TAG_NAME_ERROR, error);
+  sendResponse(_socket, response);
+}
+
+void MockStratumServer::sendResponse(QTcpSocket* _socket, const QJsonObject& _response) {
+  if (roll(m_behavior.dropResponsePercent)) {
+    ++m_droppedResponseCount;
+    return;
+  }
+
+  if (m_behavior.responseDelayMsecs == 0) {
+    write(_socket, _response);
+    return;
+  }
+
+  QPointer<QTcpSocket> socket(_socket);
+  QTimer::singleShot(m_behavior.responseDelayMsecs, this, [this, socket, _response]() {
+    if (!socket.isNull() && m_sessions.contains(socket.data())) {
+      write(socket.data(), _response);
+    }
+  });
+}
+
+void MockStratumServer::write(QTcpSocket* _socket, const QJsonObject& _message) {
+  _socket->write(QJsonDocument(_message).toJson(QJsonDocument::Compact) + "\n");
+}
+
+bool MockStratumServer::roll(quint32 _percent) const {
+  return _percent > 0 && static_cast<quint32>(qrand() % 100) < _percent;
+}
+
+}
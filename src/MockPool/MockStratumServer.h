@@ -0,0 +1,99 @@
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#pragma once
+
+#include <QHostAddress>
+#include <QJsonObject>
+#include <QMap>
+#include <QObject>
+
+class QTcpServer;
+class QTcpSocket;
+
+namespace WalletGUI {
+
+// Scripted misbehaviour of the mock pool. Percentages are per response; zero intervals disable the
+// corresponding periodic action.
+struct MockPoolBehavior {
+  quint32 difficulty;
+  quint32 maxDifficulty;
+  quint32 jobIntervalMsecs;
+  quint32 blockIntervalMsecs;
+  quint32 vardiffIntervalMsecs;
+  quint32 disconnectIntervalMsecs;
+  quint32 responseDelayMsecs;
+  quint32 dropResponsePercent;
+  quint32 errorReplyPercent;
+  bool rejectLogin;
+};
+
+// Minimal Stratum pool speaking the login/job/submit dialect of StratumClient. Jobs carry a well-formed
+// block header whose previous block hash only changes on a scripted new block. Shares are not
+// verified: a submit is accepted when it names the current job of the session, or the previous one
+// while both are on the same block.
+class MockStratumServer : public QObject {
+  Q_OBJECT
+  Q_DISABLE_COPY(MockStratumServer)
+
+public:
+  MockStratumServer(const MockPoolBehavior& _behavior, QObject* _parent);
+  ~MockStratumServer();
+
+  bool listen(const QHostAddress& _address, quint16 _port);
+  quint16 getPort() const;
+  QString getErrorString() const;
+  QJsonObject getStatistics() const;
+
+protected:
+  void timerEvent(QTimerEvent* _event) override;
+
+private:
+  struct Session {
+    QString sessionId;
+    quint32 difficulty;
+    quint32 jobCounter;
+    QString currentJobId;
+    QString previousJobId;
+    quint32 blockHeight;
+  };
+
+  const MockPoolBehavior m_behavior;
+  QTcpServer* m_server;
+  QMap<QTcpSocket*, Session> m_sessions;
+  QByteArray m_previousBlockHash;
+  quint32 m_blockHeight;
+  quint32 m_sessionCounter;
+  quint32 m_connectionCount;
+  quint32 m_loginCount;
+  quint32 m_jobCount;
+  quint32 m_blockCount;
+  quint32 m_submitCount;
+  quint32 m_acceptedShareCount;
+  quint32 m_rejectedShareCount;
+  quint32 m_droppedResponseCount;
+  quint32 m_errorReplyCount;
+  quint32 m_forcedDisconnectCount;
+  int m_jobTimerId;
+  int m_blockTimerId;
+  int m_vardiffTimerId;
+  int m_disconnectTimerId;
+
+  void newBlock();
+  void newConnection();
+  void readyRead(QTcpSocket* _socket);
+  void disconnected(QTcpSocket* _socket);
+
+  void processRequest(QTcpSocket* _socket, const QJsonObject& _request);
+  void processLogin(QTcpSocket* _socket, const QJsonValue& _id, const QJsonObject& _params);
+  void processSubmit(QTcpSocket* _socket, const QJsonValue& _id, const QJsonObject& _params);
+  QJsonObject makeJob(Session& _session);
+  void sendJobNotification(QTcpSocket* _socket);
+  void sendResult(QTcpSocket* _socket, const QJsonValue& _id, const QJsonObject& _result);
+  void sendError(QTcpSocket* _socket, const QJsonValue& _id, int _code, const QString& _message);
+  void sendResponse(QTcpSocket* _socket, const QJsonObject& _response);
+  void write(QTcpSocket* _socket, const QJsonObject& _message);
+  bool roll(quint32 _percent) const;
+};
+
+}
@@ -0,0 +1,99 @@
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QJsonDocument>
+#include <QTimer>
+
+#include <cstdio>
+
+#include "MockStratumServer.h"
+
+using namespace WalletGUI;
+
+namespace {
+
+bool parseUInt(const QCommandLineParser& _parser, const QCommandLineOption& _option, quint32 _max, quint32& _value) {
+  bool ok = false;
+  _value = _parser.value(_option).toUInt(&ok);
+  if (!ok || _value > _max) {
+    fprintf(stderr, "Invalid value for --%s: %s\n", qPrintable(_option.names().first()), qPrintable(_parser.value(_option)));
+    return false;
+  }
+
+  return true;
+}
+
+}
+
+int main(int argc, char* argv[]) {
+  QCoreApplication app(argc, argv);
+  app.setApplicationName("gdoge-mock-pool");
+
+  QCommandLineParser parser;
+  parser.setApplicationDescription("Local Stratum pool with scripted behaviour for miner testing. "
+    "Prints statistics as one JSON object per line.");
+  parser.addHelpOption();
+  QCommandLineOption addressOption("address", "Address to listen on.", "address", "127.0.0.1");
+  QCommandLineOption portOption("port", "Port to listen on, 0 to pick a free one.", "port", "3333");
+  QCommandLineOption difficultyOption("difficulty", "Initial share difficulty.", "difficulty", "1000");
+  QCommandLineOption maxDifficultyOption("max-difficulty", "Highest difficulty reached by vardiff.", "difficulty", "64000");
+  QCommandLineOption jobIntervalOption("job-interval", "Send a new job every N milliseconds.", "msecs", "0");
+  QCommandLineOption blockIntervalOption("block-interval", "Announce a new block every N milliseconds.", "msecs", "0");
+  QCommandLineOption vardiffIntervalOption("vardiff-interval", "Change difficulty every N milliseconds.", "msecs", "0");
+  QCommandLineOption disconnectIntervalOption("disconnect-interval", "Drop all connections every N milliseconds.", "msecs", "0");
+  QCommandLineOption responseDelayOption("response-delay", "Delay every response by N milliseconds.", "msecs", "0");
+  QCommandLineOption dropOption("drop-rate", "Percentage of responses never sent.", "percent", "0");
+  QCommandLineOption errorOption("error-rate", "Percentage of responses replaced by an error.", "percent", "0");
+  QCommandLineOption rejectLoginOption("reject-login", "Answer every login with an error.");
+  QCommandLineOption seedOption("seed", "Random seed for jobs, drops and errors.", "seed", "1");
+  QCommandLineOption statsIntervalOption("stats-interval", "Print statistics every N milliseconds, 0 to disable.", "msecs", "5000");
+  parser.addOptions({addressOption, portOption, difficultyOption, maxDifficultyOption, jobIntervalOption, blockIntervalOption,
+    vardiffIntervalOption, disconnectIntervalOption, responseDelayOption, dropOption, errorOption, rejectLoginOption, seedOption,
+    statsIntervalOption});
+  parser.process(app);
+
+  MockPoolBehavior behavior;
+  quint32 port = 0;
+  quint32 seed = 0;
+  quint32 statsInterval = 0;
+  if (!parseUInt(parser, portOption, 65535, port) ||
+    !parseUInt(parser, difficultyOption, 0xffffffff, behavior.difficulty) ||
+    !parseUInt(parser, maxDifficultyOption, 0xffffffff, behavior.maxDifficulty) ||
+    !parseUInt(parser, jobIntervalOption, 0x7fffffff, behavior.jobIntervalMsecs) ||
+    !parseUInt(parser, blockIntervalOption, 0x7fffffff, behavior.blockIntervalMsecs) ||
+    !parseUInt(parser, vardiffIntervalOption, 0x7fffffff, behavior.vardiffIntervalMsecs) ||
+    !parseUInt(parser, disconnectIntervalOption, 0x7fffffff, behavior.disconnectIntervalMsecs) ||
+    !parseUInt(parser, responseDelayOption, 0x7fffffff, behavior.responseDelayMsecs) ||
+    !parseUInt(parser, dropOption, 100, behavior.dropResponsePercent) ||
+    !parseUInt(parser, errorOption, 100, behavior.errorReplyPercent) ||
+    !parseUInt(parser, seedOption, 0xffffffff, seed) ||
+    !parseUInt(parser, statsIntervalOption, 0x7fffffff, statsInterval)) {
+    return 1;
+  }
+
+  behavior.difficulty = qMax<quint32>(behavior.difficulty, 1);
+  behavior.maxDifficulty = qMax(behavior.maxDifficulty, behavior.difficulty);
+  behavior.rejectLogin = parser.isSet(rejectLoginOption);
+  qsrand(seed);
+
+  MockStratumServer server(behavior, nullptr);
+  if (!server.listen(QHostAddress(parser.value(addressOption)), port)) {
+    fprintf(stderr, "Failed to listen on %s:%u: %s\n", qPrintable(parser.value(addressOption)), port, qPrintable(server.getErrorString()));
+    return 1;
+  }
+
+  fprintf(stderr, "Mock pool listening on %s:%u\n", qPrintable(parser.value(addressOption)), server.getPort());
+  QTimer statsTimer;
+  if (statsInterval > 0) {
+    QObject::connect(&statsTimer, &QTimer::timeout, [&server]() {
+      fprintf(stdout, "%s\n", QJsonDocument(server.getStatistics()).toJson(QJsonDocument::Compact).constData());
+      fflush(stdout);
+    });
+
+    statsTimer.start(statsInterval);
+  }
+
+  return app.exec();
+}
@@ -0,0 +1,25 @@
+#-------------------------------------------------
+#
+# Local mock Stratum pool for miner testing
+#
+#-------------------------------------------------
+
+QT       += core network
+QT       -= gui
+
+TARGET = gdoge-mock-pool
+TEMPLATE = app
+
+!win32: QMAKE_CXXFLAGS += -std=c++14 -Wall -Wextra
+
+CONFIG += c++14 strict_c++ console
+CONFIG -= app_bundle
+
+DESTDIR = $$PWD/../../bin
+
+SOURCES += \
+    gdoge-mock-pool.cpp \
+    MockStratumServer.cpp
+
+HEADERS += \
+    MockStratumServer.h
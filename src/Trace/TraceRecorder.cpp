@@ -0,0 +1,195 @@
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#include <QCoreApplication>
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QList>
+#include <QMutex>
+#include <QThread>
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include "TraceRecorder.h"
+#include "logger.h"
+
+namespace WalletGUI {
+
+namespace {
+
+const qint64 INSTANT_EVENT = -1;
+const double NANOSECONDS_PER_MICROSECOND = 1000;
+
+struct TraceEvent {
+  const char* name;
+  const char* category;
+  qint64 start;
+  qint64 duration;
+};
+
+// Written only by its own thread. writeCount is published after the event, so a reader sees every
+// event below it complete, except for those the writer has wrapped around to in the meantime.
+struct ThreadBuffer {
+  quint32 threadId;
+  QString threadName;
+  std::unique_ptr<TraceEvent[]> events;
+  std::atomic<quint64> writeCount;
+};
+
+// Buffers are never freed: a thread may record until the very end of the process, and the events of
+// finished threads are still worth dumping.
+struct ThreadBufferRegistry {
+  QMutex mutex;
+  QList<ThreadBuffer*> buffers;
+};
+
+ThreadBufferRegistry& getRegistry() {
+  static ThreadBufferRegistry* registry = new ThreadBufferRegistry;
+  return *registry;
+}
+
+thread_local ThreadBuffer* currentThreadBuffer = nullptr;
+
+ThreadBuffer* registerCurrentThread() {
+  ThreadBuffer* buffer = new ThreadBuffer;
+  buffer->events.reset(new TraceEvent[TraceRecorder::EVENTS_PER_THREAD]);
+  buffer->writeCount = 0;
+  QThread* thread = QThread::currentThread();
+  buffer->threadName = thread->objectName();
+  ThreadBufferRegistry& registry = getRegistry();
+  QMutexLocker locker(&registry.mutex);
+  buffer->threadId = registry.buffers.size() + 1;
+  if (buffer->threadName.isEmpty()) {
+    const bool isMainThread = QCoreApplication::instance() != nullptr && QCoreApplication::instance()->thread() == thread;
+    buffer->threadName = isMainThread ? QString("Main thread") : QString("Thread %1").arg(buffer->threadId);
+  }
+
+  registry.buffers.append(buffer);
+  return buffer;
+}
+
+void appendEvent(const TraceEvent& _event) {
+  if (Q_UNLIKELY(currentThreadBuffer == nullptr)) {
+    currentThreadBuffer = registerCurrentThread();
+  }
+
+  ThreadBuffer* buffer = currentThreadBuffer;
+  const quint64 index = buffer->writeCount.load(std::memory_order_relaxed);
+  buffer->events[index % TraceRecorder::EVENTS_PER_THREAD] = _event;
+  buffer->writeCount.store(index + 1, std::memory_order_release);
+}
+
+// Copies the events still held by the buffer. Slots the owner may have overwritten while they were
+// copied are dropped, so no torn event is ever formatted.
+std::vector<TraceEvent> copyEvents(const ThreadBuffer& _buffer) {
+  const quint64 endIndex = _buffer.writeCount.load(std::memory_order_acquire);
+  const quint64 beginIndex = endIndex > TraceRecorder::EVENTS_PER_THREAD ? endIndex - TraceRecorder::EVENTS_PER_THREAD : 0;
+  std::vector<TraceEvent> events;
+  events.reserve(endIndex - beginIndex);
+  for (quint64 index = beginIndex; index < endIndex; ++index) {
+    events.push_back(_buffer.events[index % TraceRecorder::EVENTS_PER_THREAD]);
+  }
+
+  const quint64 writeCount = _buffer.writeCount.load(std::memory_order_acquire);
+  const quint64 firstIntactIndex = writeCount + 1 > TraceRecorder::EVENTS_PER_THREAD ?
+    writeCount + 1 - TraceRecorder::EVENTS_PER_THREAD : 0;
+  if (firstIntactIndex > beginIndex) {
+    events.erase(events.begin(), events.begin() + qMin<quint64>(firstIntactIndex - beginIndex, events.size()));
+  }
+
+  return events;
+}
+
+QByteArray escapeJson(const QString& _value) {
+  QByteArray result;
+  for (const QChar& c : _value) {
+    if (c == '"' || c == '\\') {
+      result.append('\\').append(c.toLatin1());
+    } else if (c.unicode() < 0x20) {
+      result.append(QString("\\u%1").arg(c.unicode(), 4, 16, QChar('0')).toLatin1());
+    } else {
+      result.append(QString(c).toUtf8());
+    }
+  }
+
+  return result;
+}
+
+QByteArray formatMicroseconds(qint64 _nanoseconds) {
+  return QByteArray::number(_nanoseconds / NANOSECONDS_PER_MICROSECOND, 'f', 3);
+}
+
+}
+
+const quint32 TraceRecorder::EVENTS_PER_THREAD;
+std::atomic<bool> TraceRecorder::m_enabled(false);
+
+void TraceRecorder::setEnabled(bool _enabled) {
+  m_enabled = _enabled;
+}
+
+qint64 TraceRecorder::now() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void TraceRecorder::addComplete(const char* _name, const char* _category, qint64 _start, qint64 _duration) {
+  appendEvent({_name, _category, _start, _duration});
+}
+
+void TraceRecorder::addInstant(const char* _name, const char* _category) {
+  if (isEnabled()) {
+    appendEvent({_name, _category, now(), INSTANT_EVENT});
+  }
+}
+
+QByteArray TraceRecorder::toJson() {
+  QList<ThreadBuffer*> buffers;
+  {
+    ThreadBufferRegistry& registry = getRegistry();
+    QMutexLocker locker(&registry.mutex);
+    buffers = registry.buffers;
+  }
+
+  const QByteArray pid = QByteArray::number(QCoreApplication::applicationPid());
+  QByteArray json = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+  bool isFirst = true;
+  for (const ThreadBuffer* buffer : buffers) {
+    const QByteArray tid = QByteArray::number(buffer->threadId);
+    json.append(isFirst ? "\n" : ",\n");
+    isFirst = false;
+    json.append("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":").append(pid).append(",\"tid\":").append(tid).
+      append(",\"args\":{\"name\":\"").append(escapeJson(buffer->threadName)).append("\"}}");
+    for (const TraceEvent& event : copyEvents(*buffer)) {
+      json.append(",\n{\"name\":\"").append(escapeJson(event.name)).append("\",\"cat\":\"").append(escapeJson(event.category)).
+        append("\",\"pid\":").append(pid).append(",\"tid\":").append(tid).append(",\"ts\":").append(formatMicroseconds(event.start));
+      if (event.duration == INSTANT_EVENT) {
+        json.append(",\"ph\":\"i\",\"s\":\"t\"}");
+      } else {
+        json.append(",\"ph\":\"X\",\"dur\":").append(formatMicroseconds(event.duration)).append('}');
+      }
+    }
+  }
+
+  json.append("\n]}\n");
+  return json;
+}
+
+bool TraceRecorder::dump(const QString& _fileName) {
+  QFile file(_fileName);
+  if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate) || file.write(toJson()) < 0) {
+    WalletLogger::warning(QString("[Trace] Failed to write %1: %2").arg(_fileName).arg(file.errorString()));
+    return false;
+  }
+
+  WalletLogger::info(QString("[Trace] Trace written to %1").arg(_fileName));
+  return true;
+}
+
+QString TraceRecorder::makeFileName(const QDir& _dir) {
+  return _dir.absoluteFilePath(QString("trace-%1.json").arg(QDateTime::currentDateTime().toString("yyyyMMdd-hhmmss")));
+}
+
+}
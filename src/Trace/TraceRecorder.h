@@ -0,0 +1,66 @@
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#pragma once
+
+#include <QtGlobal>
+
+#include <atomic>
+
+class QByteArray;
+class QDir;
+class QString;
+
+namespace WalletGUI {
+
+// Records trace events of the hot paths into one ring buffer per thread and writes them out in the
+// Chrome trace event format, which chrome://tracing and Perfetto open directly. Recording is off by
+// default; while it is off an event costs one relaxed atomic load. Every buffer keeps the latest
+// EVENTS_PER_THREAD events, so a dump shows the last moments before it was taken.
+// Event names and categories must be string literals: only the pointers are stored.
+class TraceRecorder {
+public:
+  static const quint32 EVENTS_PER_THREAD = 32768;
+
+  static bool isEnabled() {
+    return m_enabled.load(std::memory_order_relaxed);
+  }
+
+  static void setEnabled(bool _enabled);
+  // Monotonic time in nanoseconds, the time base of all events.
+  static qint64 now();
+
+  static void addComplete(const char* _name, const char* _category, qint64 _start, qint64 _duration);
+  static void addInstant(const char* _name, const char* _category);
+
+  static QByteArray toJson();
+  static bool dump(const QString& _fileName);
+  // trace-<local time>.json in _dir.
+  static QString makeFileName(const QDir& _dir);
+
+private:
+  static std::atomic<bool> m_enabled;
+};
+
+// Records the lifetime of the scope as one complete event.
+class TraceScope {
+  Q_DISABLE_COPY(TraceScope)
+
+public:
+  TraceScope(const char* _name, const char* _category) : m_name(_name), m_category(_category),
+    m_start(TraceRecorder::isEnabled() ? TraceRecorder::now() : -1) {
+  }
+
+  ~TraceScope() {
+    if (m_start >= 0) {
+      TraceRecorder::addComplete(m_name, m_category, m_start, TraceRecorder::now() - m_start);
+    }
+  }
+
+private:
+  const char* m_name;
+  const char* m_category;
+  const qint64 m_start;
+};
+
+}
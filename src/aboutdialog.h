@@ -1,26 +1,26 @@
-// Copyright (c) 2015-2018, The Bytecoin developers. 2019 GoldenDoge developer
-// Licensed under the GNU Lesser General Public License. See LICENSE for details.
-
-#pragma once
-
-#include <QDialog>
-
-namespace Ui {
-class AboutDialog;
-}
-
-namespace WalletGUI {
-
-class AboutDialog : public QDialog {
-  Q_OBJECT
-  Q_DISABLE_COPY(AboutDialog)
-
-public:
-  explicit AboutDialog(QWidget* _parent);
-  ~AboutDialog();
-
-private:
-  QScopedPointer<Ui::AboutDialog> m_ui;
-};
-
-}
+// Copyright (c) 2015-2018, The Bytecoin developers. 2019 GoldenDoge developer
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#pragma once
+
+#include <QDialog>
+
+namespace Ui {
+class AboutDialog;
+}
+
+namespace WalletGUI {
+
+class AboutDialog : public QDialog {
+  Q_OBJECT
+  Q_DISABLE_COPY(AboutDialog)
+
+public:
+  explicit AboutDialog(QWidget* _parent);
+  ~AboutDialog();
+
+private:
+  QScopedPointer<Ui::AboutDialog> m_ui;
+};
+
+}
@@ -0,0 +1,107 @@
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#include <QtMath>
+
+#include "jsonrpcstatisticsdialog.h"
+#include "ui_jsonrpcstatisticsdialog.h"
+#include "walletd.h"
+#include "JsonRpc/JsonRpcClient.h"
+
+namespace WalletGUI
+{
+
+namespace
+{
+
+constexpr int REFRESH_INTERVAL = 1000;
+
+enum Columns
+{
+    COLUMN_METHOD, COLUMN_CALLS, COLUMN_ERRORS, COLUMN_P50, COLUMN_P90, COLUMN_P99, COLUMN_MEAN, COLUMN_MEAN_PARSE,
+    COLUMN_MEAN_REQUEST_SIZE, COLUMN_MEAN_RESPONSE_SIZE, COLUMN_MAX_RESPONSE_SIZE, COLUMN_COUNT
+};
+
+// Percentiles are bucket upper bounds, so they are shown as "at most".
+QString formatPercentile(double milliseconds)
+{
+    return qIsInf(milliseconds) ?
+        QString("> %1").arg(LatencyHistogram::getBucketUpperBound(LatencyHistogram::getBucketCount() - 2)) :
+        QString("<= %1").arg(milliseconds);
+}
+
+QString formatMean(double sum, quint64 count)
+{
+    return count > 0 ? QString::number(sum / count, 'f', 2) : QString("-");
+}
+
+void setCell(QTableWidget* table, int row, int column, const QString& text)
+{
+    QTableWidgetItem* item = new QTableWidgetItem(text);
+    if (column != COLUMN_METHOD)
+        item->setTextAlignment(Qt::AlignRight | Qt::AlignVCenter);
+    table->setItem(row, column, item);
+}
+
+}
+
+JsonRpcStatisticsDialog::JsonRpcStatisticsDialog(RemoteWalletd* walletd, QWidget *parent)
+    : QDialog(parent)
+    , ui(new Ui::JsonRpcStatisticsDialog)
+    , walletd_(walletd)
+{
+    ui->setupUi(this);
+    ui->statisticsTable->setColumnCount(COLUMN_COUNT);
+    ui->statisticsTable->setHorizontalHeaderLabels({tr("Method"), tr("Calls"), tr("Errors"), tr("p50, ms"), tr("p90, ms"),
+        tr("p99, ms"), tr("Mean, ms"), tr("Mean parse, ms"), tr("Mean sent, B"), tr("Mean received, B"), tr("Max received, B")});
+
+    refreshTimer_.setInterval(REFRESH_INTERVAL);
+    connect(&refreshTimer_, &QTimer::timeout, this, &JsonRpcStatisticsDialog::refresh);
+    refreshTimer_.start();
+    refresh();
+}
+
+JsonRpcStatisticsDialog::~JsonRpcStatisticsDialog()
+{
+    delete ui;
+}
+
+void JsonRpcStatisticsDialog::refresh()
+{
+    QTableWidget* table = ui->statisticsTable;
+    if (walletd_.isNull())
+    {
+        table->setRowCount(0);
+        return;
+    }
+
+    const QMap<QString, JsonRpc::MethodStatistics>& methodStatistics = walletd_->getMethodStatistics();
+    table->setRowCount(methodStatistics.size());
+    int row = 0;
+    for (auto it = methodStatistics.cbegin(); it != methodStatistics.cend(); ++it, ++row)
+    {
+        const JsonRpc::MethodStatistics& statistics = it.value();
+        setCell(table, row, COLUMN_METHOD, it.key());
+        setCell(table, row, COLUMN_CALLS, QString::number(statistics.requestCount));
+        setCell(table, row, COLUMN_ERRORS, QString::number(statistics.errorCount));
+        setCell(table, row, COLUMN_P50, formatPercentile(statistics.latency.getPercentile(0.5)));
+        setCell(table, row, COLUMN_P90, formatPercentile(statistics.latency.getPercentile(0.9)));
+        setCell(table, row, COLUMN_P99, formatPercentile(statistics.latency.getPercentile(0.99)));
+        setCell(table, row, COLUMN_MEAN, formatMean(statistics.latency.getSum(), statistics.latency.getCount()));
+        setCell(table, row, COLUMN_MEAN_PARSE, formatMean(statistics.parseTime.getSum(), statistics.parseTime.getCount()));
+        setCell(table, row, COLUMN_MEAN_REQUEST_SIZE, formatMean(statistics.requestBytes, statistics.requestCount));
+        setCell(table, row, COLUMN_MEAN_RESPONSE_SIZE, formatMean(statistics.responseBytes, statistics.latency.getCount()));
+        setCell(table, row, COLUMN_MAX_RESPONSE_SIZE, QString::number(statistics.maxResponseBytes));
+    }
+
+    table->resizeColumnsToContents();
+}
+
+void JsonRpcStatisticsDialog::resetStatistics()
+{
+    if (!walletd_.isNull())
+        walletd_->resetMethodStatistics();
+    refresh();
+}
+
+}
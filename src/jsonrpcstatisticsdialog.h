@@ -0,0 +1,41 @@
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#ifndef JSONRPCSTATISTICSDIALOG_H
+#define JSONRPCSTATISTICSDIALOG_H
+
+#include <QDialog>
+#include <QPointer>
+#include <QTimer>
+
+namespace Ui {
+class JsonRpcStatisticsDialog;
+}
+
+namespace WalletGUI
+{
+
+class RemoteWalletd;
+
+// Debug page with the per-method JSON-RPC counters of the walletd connection.
+class JsonRpcStatisticsDialog : public QDialog
+{
+    Q_OBJECT
+
+public:
+    explicit JsonRpcStatisticsDialog(RemoteWalletd* walletd, QWidget *parent = 0);
+    ~JsonRpcStatisticsDialog();
+
+public slots:
+    void refresh();
+    void resetStatistics();
+
+private:
+    Ui::JsonRpcStatisticsDialog *ui;
+    QPointer<RemoteWalletd> walletd_;
+    QTimer refreshTimer_;
+};
+
+}
+
+#endif // JSONRPCSTATISTICSDIALOG_H
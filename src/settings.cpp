@@ -1,347 +1,553 @@
-// Copyright (c) 2015-2018, The Bytecoin developers.
-// Licensed under the GNU Lesser General Public License. See LICENSE for details.
-
-#include <QSettings>
-#include <QJsonDocument>
-#include <QJsonObject>
-#include <QThread>
-#include <QStandardPaths>
-#include <QApplication>
-
-#include "settings.h"
-#include "common.h"
-#include "version.h"
-
-namespace WalletGUI
-{
-
-namespace
-{
-
-constexpr char OPTION_WALLET_FILE[] = "walletFile";
-constexpr char OPTION_LOCAL_RPC_PORT[] = "localRpcPort";
-constexpr char OPTION_REMOTE_RPC_END_POINT[] = "remoteRpcEndPoint";
-constexpr char OPTION_CONNECTION_METHOD[] = "connectionMethod";
-constexpr char OPTION_MINING_POOL_SWITCH_STRATEGY[] = "miningPoolSwitchStrategy";
-constexpr char OPTION_MINING_CPU_CORE_COUNT[] = "miningCpuCoreCount";
-constexpr char OPTION_MINING_POOL_LIST[] = "miningPoolList";
-constexpr char OPTION_RECENT_WALLETS[] = "recentWallets";
-constexpr char OPTION_WALLETD_PARAMS[] = "walletdParams";
-
-constexpr quint16 DEFAULT_LOCAL_RPC_PORT = 4042;
-constexpr char LOCAL_HOST[] = "127.0.0.1";
-
-#if defined(Q_OS_LINUX)
-constexpr char DEFAULT_WORK_DIR[] = ".GoldenDoge";
-#endif
-
-const constexpr char* DEFAULT_MINING_POOLS[] = { "goldendoge.m2pool.eu:4425" };
-
-static
-bool readJsonFile(QIODevice& device, QSettings::SettingsMap& map)
-{
-    const QJsonDocument json = QJsonDocument::fromJson(device.readAll());
-    map = json.object().toVariantMap();
-    return true;
-}
-
-static
-bool writeJsonFile(QIODevice& device, const QSettings::SettingsMap& map)
-{
-    device.write(QJsonDocument(QJsonObject::fromVariantMap(map)).toJson());
-    return true;
-}
-
-static
-int getCoreCount()
-{
-    const int maxCpuCoreCount = QThread::idealThreadCount();
-    return maxCpuCoreCount <= 0 ? 1 : maxCpuCoreCount;
-}
-
-}
-
-Settings::Settings()
-{
-    const QSettings::Format jsonFormat = QSettings::registerFormat("json", readJsonFile, writeJsonFile);
-    QSettings::setDefaultFormat(jsonFormat);
-    makeDataDir(getDefaultWorkDir());
-    const QString jsonFile = getDefaultWorkDir().absoluteFilePath("GoldenDoge-gui.config");
-
-    settings_.reset(new QSettings(jsonFile, jsonFormat));
-}
-
-Settings& Settings::instance()
-{
-    static Settings settings;
-    return settings;
-}
-
-QSettings::Format Settings::getFormat() const
-{
-    return settings_->format();
-}
-
-quint16 Settings::getLocalRpcPort() const
-{
-    return settings_->value(OPTION_LOCAL_RPC_PORT, getDefaultRpcPort()).toUInt();
-}
-
-QString Settings::getRemoteRpcEndPoint() const
-{
-    return settings_->value(OPTION_REMOTE_RPC_END_POINT).toString();
-}
-
-QString Settings::getLocalRpcEndPoint() const
-{
-    return QString("%1:%2").arg(LOCAL_HOST).arg(getLocalRpcPort());
-}
-
-QString Settings::getBuilinRpcEndPoint() const
-{
-    return QString("%1:%2").arg(LOCAL_HOST).arg(getDefaultRpcPort());
-}
-
-QString Settings::getRpcEndPoint() const
-{
-    switch(getConnectionMethod())
-    {
-    case ConnectionMethod::BUILTIN:return getBuilinRpcEndPoint();
-    case ConnectionMethod::LOCAL:   return getLocalRpcEndPoint();
-    case ConnectionMethod::REMOTE:  return getRemoteRpcEndPoint();
-    }
-    return QString();
-}
-
-ConnectionMethod Settings::getConnectionMethod() const
-{
-    return static_cast<ConnectionMethod>(settings_->value(OPTION_CONNECTION_METHOD, static_cast<int>(getDefaultConnectionMethod())).toInt());
-}
-
-QString Settings::getUserFriendlyConnectionMethod() const
-{
-    switch(getConnectionMethod())
-    {
-    case ConnectionMethod::BUILTIN:return tr("built-in walletd");
-    case ConnectionMethod::LOCAL:   return tr("local walletd");
-    case ConnectionMethod::REMOTE:  return getRemoteRpcEndPoint();
-    }
-    return QString();
-}
-
-MiningPoolSwitchStrategy Settings::getMiningPoolSwitchStrategy() const
-{
-    return static_cast<MiningPoolSwitchStrategy>(settings_->value(OPTION_MINING_POOL_SWITCH_STRATEGY, static_cast<int>(getDefaultMiningPoolSwitchStrategy())).toInt());
-}
-
-quint32 Settings::getMiningCpuCoreCount() const
-{
-    return settings_->value(OPTION_MINING_CPU_CORE_COUNT, getDefaultMiningCpuCoreCount()).toUInt();
-}
-
-QStringList Settings::getMiningPoolList() const
-{
-    QStringList result = getStringList(OPTION_MINING_POOL_LIST, getDefaultMiningPoolList());
-    result.removeDuplicates();
-    return result;
-}
-
-QStringList Settings::getRecentWallets() const
-{
-    return getStringList(OPTION_RECENT_WALLETS, QStringList());
-}
-
-QString Settings::getWalletFile() const
-{
-    return settings_->value(OPTION_WALLET_FILE).toString();
-}
-
-QStringList Settings::getWalletdParams() const
-{
-    return settings_->value(OPTION_WALLETD_PARAMS).toString().split(QChar(' '), QString::SkipEmptyParts);
-}
-
-
-void Settings::setWalletdParams(const QString& params)
-{
-    settings_->setValue(OPTION_WALLETD_PARAMS, params);
-}
-
-void Settings::setLocalRpcPort(quint16 port)
-{
-    settings_->setValue(OPTION_LOCAL_RPC_PORT, port);
-}
-
-void Settings::setRemoteRpcEndPoint(const QString& host, quint16 port)
-{
-    settings_->setValue(OPTION_REMOTE_RPC_END_POINT, QString("%1:%2").arg(host).arg(port));
-}
-
-void Settings::setConnectionMethod(ConnectionMethod method)
-{
-    settings_->setValue(OPTION_CONNECTION_METHOD, static_cast<int>(method));
-}
-
-void Settings::setMiningPoolSwitchStrategy(MiningPoolSwitchStrategy strategy)
-{
-    settings_->setValue(OPTION_MINING_POOL_SWITCH_STRATEGY, static_cast<int>(strategy));
-}
-
-void Settings::setMiningCpuCoreCount(quint32 count)
-{
-    settings_->setValue(OPTION_MINING_CPU_CORE_COUNT, count);
-}
-
-void Settings::setMiningPoolList(const QStringList& pools)
-{
-    settings_->setValue(OPTION_MINING_POOL_LIST, pools);
-}
-
-void Settings::setWalletFile(const QString& walletFile)
-{
-    settings_->setValue(OPTION_WALLET_FILE, walletFile);
-}
-
-void Settings::setRecentWallets(const QStringList& wallets)
-{
-    settings_->setValue(OPTION_RECENT_WALLETS, wallets);
-}
-
-void Settings::addRecentWallet(const QString& wallet)
-{
-    QStringList wallets = getRecentWallets();
-    wallets.removeOne(wallet);
-    wallets.push_front(wallet);
-    setRecentWallets(wallets);
-}
-
-void Settings::clearRecentWallets()
-{
-    setRecentWallets(QStringList());
-}
-
-/*static*/
-quint16 Settings::getDefaultRpcPort()
-{
-    return DEFAULT_LOCAL_RPC_PORT;
-}
-
-/*static*/
-QDir Settings::getDefaultWorkDir()
-{
-#if defined(Q_OS_WIN32)
-    return QStandardPaths::writableLocation(QStandardPaths::AppDataLocation);
-#elif defined(Q_OS_MAC)
-    return QStandardPaths::writableLocation(QStandardPaths::AppDataLocation);
-#elif defined(Q_OS_LINUX)
-    return QDir::homePath() + '/' + DEFAULT_WORK_DIR;
-#else
-    return QStandardPaths::writableLocation(QStandardPaths::AppDataLocation);
-#endif
-}
-
-///*static*/
-//QString Settings::getDefaultRpcPath()
-//{
-//    return DEFAULT_RPC_PATH;
-//}
-
-/*static*/
-QString Settings::getDefaultWalletdPath()
-{
-    const QString dir = qApp->applicationDirPath();
-#ifdef Q_OS_WIN32
-    return dir + '/' + "walletd.exe";
-#else
-    return dir + '/' + "walletd";
-#endif
-}
-
-/*static*/
-ConnectionMethod Settings::getDefaultConnectionMethod()
-{
-    return ConnectionMethod::BUILTIN;
-}
-
-/*static*/
-MiningPoolSwitchStrategy Settings::getDefaultMiningPoolSwitchStrategy()
-{
-    return MiningPoolSwitchStrategy::FAILOVER;
-}
-
-/*static*/
-quint32 Settings::getDefaultMiningCpuCoreCount()
-{
-    return (getCoreCount() +1) / 2;
-}
-
-/*static*/
-void Settings::makeDataDir(const QDir& dataDir)
-{
-    if (!dataDir.exists())
-        dataDir.mkpath(dataDir.absolutePath());
-}
-
-/*static*/
-QStringList Settings::getDefaultMiningPoolList()
-{
-    QStringList result;
-    static constexpr size_t size = sizeof(DEFAULT_MINING_POOLS) / sizeof(DEFAULT_MINING_POOLS[0]);
-    std::copy(DEFAULT_MINING_POOLS, DEFAULT_MINING_POOLS + size, std::back_inserter(result));
-    return result;
-}
-
-/*static*/
-QString Settings::getVersion()
-{
-    return VERSION;
-}
-
-/*static*/
-QString Settings::getVersionSuffix()
-{
-    return VERSION_SUFFIX;
-}
-
-/*static*/
-QString Settings::getRevision()
-{
-    return REVISION;
-}
-
-/*static*/
-bool Settings::isStableVersion()
-{
-    return getVersionSuffix() == "stable";
-}
-
-void Settings::restoreDefaultPoolList()
-{
-    const auto defaultPoolList = getDefaultMiningPoolList();
-    if (!settings_->contains(OPTION_MINING_POOL_LIST))
-        setMiningPoolList(QStringList() << defaultPoolList);
-    else
-    {
-        QStringList poolList = getMiningPoolList();
-        for (const QString& pool : defaultPoolList)
-        {
-            if (!poolList.contains(pool))
-                poolList << pool;
-        }
-
-        setMiningPoolList(poolList);
-    }
-}
-
-QStringList Settings::getStringList(const QString& key, const QVariant& defaultValue) const
-{
-    return settings_->value(key, defaultValue).value<QStringList>();
-}
-
-bool Settings::connectionMethodSet() const
-{
-    return settings_->contains(OPTION_CONNECTION_METHOD);
-}
-
-
-}
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#include <QSettings>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QThread>
+#include <QStandardPaths>
+#include <QCoreApplication>
+
+#include "settings.h"
+#include "common.h"
+#include "version.h"
+
+namespace WalletGUI
+{
+
+namespace
+{
+
+constexpr char OPTION_WALLET_FILE[] = "walletFile";
+constexpr char OPTION_LOCAL_RPC_PORT[] = "localRpcPort";
+constexpr char OPTION_REMOTE_RPC_END_POINT[] = "remoteRpcEndPoint";
+constexpr char OPTION_CONNECTION_METHOD[] = "connectionMethod";
+constexpr char OPTION_MINING_POOL_SWITCH_STRATEGY[] = "miningPoolSwitchStrategy";
+constexpr char OPTION_MINING_CPU_CORE_COUNT[] = "miningCpuCoreCount";
+constexpr char OPTION_MINING_POOL_LIST[] = "miningPoolList";
+constexpr char OPTION_MINING_NONCE_BATCH_SIZE[] = "miningNonceBatchSize";
+constexpr char OPTION_MINING_PIN_THREADS[] = "miningPinThreads";
+constexpr char OPTION_MINING_EXCLUDED_CPUS[] = "miningExcludedCpus";
+constexpr char OPTION_MINING_HOT_STANDBY[] = "miningHotStandby";
+constexpr char OPTION_MINING_IDLE_PRIORITY[] = "miningIdlePriority";
+constexpr char OPTION_MINING_NICE_LEVEL[] = "miningNiceLevel";
+constexpr char OPTION_MINING_DUTY_CYCLE[] = "miningDutyCycle";
+constexpr char OPTION_MINING_NONCE_INSTANCE_ID[] = "miningNonceInstanceId";
+constexpr char OPTION_MINING_NONCE_PARTITION_BITS[] = "miningNoncePartitionBits";
+constexpr char OPTION_MINING_AUTO_DIFFICULTY[] = "miningAutoDifficulty";
+constexpr char OPTION_MINING_SHARES_PER_MINUTE[] = "miningSharesPerMinute";
+constexpr char OPTION_MINING_DIFFICULTY_DRIFT_THRESHOLD[] = "miningDifficultyDriftThreshold";
+constexpr char OPTION_METRICS_PORT[] = "metricsPort";
+constexpr char OPTION_TRACE_ENABLED[] = "traceEnabled";
+constexpr char OPTION_RECENT_WALLETS[] = "recentWallets";
+constexpr char OPTION_WALLETD_PARAMS[] = "walletdParams";
+
+constexpr quint16 DEFAULT_LOCAL_RPC_PORT = 4042;
+constexpr quint32 DEFAULT_MINING_NONCE_BATCH_SIZE = 256;
+constexpr quint32 MIN_MINING_NONCE_BATCH_SIZE = 64;
+constexpr quint32 MAX_MINING_NONCE_BATCH_SIZE = 4096;
+constexpr int MAX_MINING_NICE_LEVEL = 19;
+constexpr quint32 MIN_MINING_DUTY_CYCLE = 1;
+constexpr quint32 MAX_MINING_DUTY_CYCLE = 100;
+constexpr quint32 MAX_MINING_NONCE_PARTITION_BITS = 8;
+constexpr quint32 DEFAULT_MINING_SHARES_PER_MINUTE = 2;
+constexpr quint32 MIN_MINING_SHARES_PER_MINUTE = 1;
+constexpr quint32 MAX_MINING_SHARES_PER_MINUTE = 60;
+constexpr quint32 DEFAULT_MINING_DIFFICULTY_DRIFT_THRESHOLD = 25;
+constexpr quint32 MIN_MINING_DIFFICULTY_DRIFT_THRESHOLD = 5;
+constexpr quint32 MAX_MINING_DIFFICULTY_DRIFT_THRESHOLD = 100;
+constexpr char LOCAL_HOST[] = "127.0.0.1";
+
+#if defined(Q_OS_LINUX)
+constexpr bool DEFAULT_MINING_PIN_THREADS = true;
+#else
+constexpr bool DEFAULT_MINING_PIN_THREADS = false;
+#endif
+
+#if defined(Q_OS_LINUX)
+constexpr char DEFAULT_WORK_DIR[] = ".GoldenDoge";
+#endif
+
+const constexpr char* DEFAULT_MINING_POOLS[] = { "goldendoge.m2pool.eu:4425" };
+
+static
+bool readJsonFile(QIODevice& device, QSettings::SettingsMap& map)
+{
+    const QJsonDocument json = QJsonDocument::fromJson(device.readAll());
+    map = json.object().toVariantMap();
+    return true;
+}
+
+static
+bool writeJsonFile(QIODevice& device, const QSettings::SettingsMap& map)
+{
+    device.write(QJsonDocument(QJsonObject::fromVariantMap(map)).toJson());
+    return true;
+}
+
+static
+int getCoreCount()
+{
+    const int maxCpuCoreCount = QThread::idealThreadCount();
+    return maxCpuCoreCount <= 0 ? 1 : maxCpuCoreCount;
+}
+
+}
+
+Settings::Settings()
+{
+    const QSettings::Format jsonFormat = QSettings::registerFormat("json", readJsonFile, writeJsonFile);
+    QSettings::setDefaultFormat(jsonFormat);
+    makeDataDir(getDefaultWorkDir());
+    const QString jsonFile = getDefaultWorkDir().absoluteFilePath("GoldenDoge-gui.config");
+
+    settings_.reset(new QSettings(jsonFile, jsonFormat));
+}
+
+Settings& Settings::instance()
+{
+    static Settings settings;
+    return settings;
+}
+
+QSettings::Format Settings::getFormat() const
+{
+    return settings_->format();
+}
+
+quint16 Settings::getLocalRpcPort() const
+{
+    return settings_->value(OPTION_LOCAL_RPC_PORT, getDefaultRpcPort()).toUInt();
+}
+
+QString Settings::getRemoteRpcEndPoint() const
+{
+    return settings_->value(OPTION_REMOTE_RPC_END_POINT).toString();
+}
+
+QString Settings::getLocalRpcEndPoint() const
+{
+    return QString("%1:%2").arg(LOCAL_HOST).arg(getLocalRpcPort());
+}
+
+QString Settings::getBuilinRpcEndPoint() const
+{
+    return QString("%1:%2").arg(LOCAL_HOST).arg(getDefaultRpcPort());
+}
+
+QString Settings::getRpcEndPoint() const
+{
+    switch(getConnectionMethod())
+    {
+    case ConnectionMethod::BUILTIN:return getBuilinRpcEndPoint();
+    case ConnectionMethod::LOCAL:   return getLocalRpcEndPoint();
+    case ConnectionMethod::REMOTE:  return getRemoteRpcEndPoint();
+    }
+    return QString();
+}
+
+ConnectionMethod Settings::getConnectionMethod() const
+{
+    return static_cast<ConnectionMethod>(settings_->value(OPTION_CONNECTION_METHOD, static_cast<int>(getDefaultConnectionMethod())).toInt());
+}
+
+QString Settings::getUserFriendlyConnectionMethod() const
+{
+    switch(getConnectionMethod())
+    {
+    case ConnectionMethod::BUILTIN:return tr("built-in walletd");
+    case ConnectionMethod::LOCAL:   return tr("local walletd");
+    case ConnectionMethod::REMOTE:  return getRemoteRpcEndPoint();
+    }
+    return QString();
+}
+
+MiningPoolSwitchStrategy Settings::getMiningPoolSwitchStrategy() const
+{
+    return static_cast<MiningPoolSwitchStrategy>(settings_->value(OPTION_MINING_POOL_SWITCH_STRATEGY, static_cast<int>(getDefaultMiningPoolSwitchStrategy())).toInt());
+}
+
+quint32 Settings::getMiningCpuCoreCount() const
+{
+    return settings_->value(OPTION_MINING_CPU_CORE_COUNT, getDefaultMiningCpuCoreCount()).toUInt();
+}
+
+quint32 Settings::getMiningNonceBatchSize() const
+{
+    const quint32 size = settings_->value(OPTION_MINING_NONCE_BATCH_SIZE, getDefaultMiningNonceBatchSize()).toUInt();
+    return qBound(MIN_MINING_NONCE_BATCH_SIZE, size, MAX_MINING_NONCE_BATCH_SIZE);
+}
+
+QStringList Settings::getMiningPoolList() const
+{
+    QStringList result = getStringList(OPTION_MINING_POOL_LIST, getDefaultMiningPoolList());
+    result.removeDuplicates();
+    return result;
+}
+
+bool Settings::isMiningThreadPinningEnabled() const
+{
+    return settings_->value(OPTION_MINING_PIN_THREADS, DEFAULT_MINING_PIN_THREADS).toBool();
+}
+
+bool Settings::isMiningHotStandbyEnabled() const
+{
+    return settings_->value(OPTION_MINING_HOT_STANDBY, false).toBool();
+}
+
+bool Settings::isMiningIdlePriorityEnabled() const
+{
+    return settings_->value(OPTION_MINING_IDLE_PRIORITY, false).toBool();
+}
+
+int Settings::getMiningNiceLevel() const
+{
+    const int level = settings_->value(OPTION_MINING_NICE_LEVEL, 0).toInt();
+    return qBound(0, level, MAX_MINING_NICE_LEVEL);
+}
+
+quint32 Settings::getMiningDutyCycle() const
+{
+    const quint32 percent = settings_->value(OPTION_MINING_DUTY_CYCLE, getDefaultMiningDutyCycle()).toUInt();
+    return qBound(MIN_MINING_DUTY_CYCLE, percent, MAX_MINING_DUTY_CYCLE);
+}
+
+// Instances mining on the same login use the same bit count and distinct ids below 2^bits.
+quint32 Settings::getMiningNonceInstanceId() const
+{
+    const quint32 id = settings_->value(OPTION_MINING_NONCE_INSTANCE_ID, 0).toUInt();
+    return id & ((1u << getMiningNoncePartitionBits()) - 1);
+}
+
+quint32 Settings::getMiningNoncePartitionBits() const
+{
+    const quint32 bits = settings_->value(OPTION_MINING_NONCE_PARTITION_BITS, 0).toUInt();
+    return qMin(bits, MAX_MINING_NONCE_PARTITION_BITS);
+}
+
+bool Settings::isMiningAutoDifficultyEnabled() const
+{
+    return settings_->value(OPTION_MINING_AUTO_DIFFICULTY, false).toBool();
+}
+
+quint32 Settings::getMiningSharesPerMinute() const
+{
+    const quint32 shares = settings_->value(OPTION_MINING_SHARES_PER_MINUTE, DEFAULT_MINING_SHARES_PER_MINUTE).toUInt();
+    return qBound(MIN_MINING_SHARES_PER_MINUTE, shares, MAX_MINING_SHARES_PER_MINUTE);
+}
+
+quint32 Settings::getMiningDifficultyDriftThreshold() const
+{
+    const quint32 percent = settings_->value(OPTION_MINING_DIFFICULTY_DRIFT_THRESHOLD, DEFAULT_MINING_DIFFICULTY_DRIFT_THRESHOLD).toUInt();
+    return qBound(MIN_MINING_DIFFICULTY_DRIFT_THRESHOLD, percent, MAX_MINING_DIFFICULTY_DRIFT_THRESHOLD);
+}
+
+QList<int> Settings::getMiningExcludedCpus() const
+{
+    QList<int> result;
+    for (const QString& cpu : getStringList(OPTION_MINING_EXCLUDED_CPUS, QStringList()))
+    {
+        bool ok = false;
+        const int value = cpu.toInt(&ok);
+        if (ok && value >= 0)
+            result.append(value);
+    }
+
+    return result;
+}
+
+quint16 Settings::getMetricsPort() const
+{
+    return settings_->value(OPTION_METRICS_PORT, 0).toUInt();
+}
+
+bool Settings::isTraceEnabled() const
+{
+    return settings_->value(OPTION_TRACE_ENABLED, false).toBool();
+}
+
+QStringList Settings::getRecentWallets() const
+{
+    return getStringList(OPTION_RECENT_WALLETS, QStringList());
+}
+
+QString Settings::getWalletFile() const
+{
+    return settings_->value(OPTION_WALLET_FILE).toString();
+}
+
+QStringList Settings::getWalletdParams() const
+{
+    return settings_->value(OPTION_WALLETD_PARAMS).toString().split(QChar(' '), QString::SkipEmptyParts);
+}
+
+
+void Settings::setWalletdParams(const QString& params)
+{
+    settings_->setValue(OPTION_WALLETD_PARAMS, params);
+}
+
+void Settings::setLocalRpcPort(quint16 port)
+{
+    settings_->setValue(OPTION_LOCAL_RPC_PORT, port);
+}
+
+void Settings::setRemoteRpcEndPoint(const QString& host, quint16 port)
+{
+    settings_->setValue(OPTION_REMOTE_RPC_END_POINT, QString("%1:%2").arg(host).arg(port));
+}
+
+void Settings::setConnectionMethod(ConnectionMethod method)
+{
+    settings_->setValue(OPTION_CONNECTION_METHOD, static_cast<int>(method));
+}
+
+void Settings::setMiningPoolSwitchStrategy(MiningPoolSwitchStrategy strategy)
+{
+    settings_->setValue(OPTION_MINING_POOL_SWITCH_STRATEGY, static_cast<int>(strategy));
+}
+
+void Settings::setMiningCpuCoreCount(quint32 count)
+{
+    settings_->setValue(OPTION_MINING_CPU_CORE_COUNT, count);
+}
+
+void Settings::setMiningNonceBatchSize(quint32 size)
+{
+    settings_->setValue(OPTION_MINING_NONCE_BATCH_SIZE, size);
+}
+
+void Settings::setMiningThreadPinningEnabled(bool enabled)
+{
+    settings_->setValue(OPTION_MINING_PIN_THREADS, enabled);
+}
+
+void Settings::setMiningHotStandbyEnabled(bool enabled)
+{
+    settings_->setValue(OPTION_MINING_HOT_STANDBY, enabled);
+}
+
+void Settings::setMiningIdlePriorityEnabled(bool enabled)
+{
+    settings_->setValue(OPTION_MINING_IDLE_PRIORITY, enabled);
+}
+
+void Settings::setMiningNiceLevel(int level)
+{
+    settings_->setValue(OPTION_MINING_NICE_LEVEL, level);
+}
+
+void Settings::setMiningDutyCycle(quint32 percent)
+{
+    settings_->setValue(OPTION_MINING_DUTY_CYCLE, percent);
+}
+
+void Settings::setMiningNonceInstanceId(quint32 id)
+{
+    settings_->setValue(OPTION_MINING_NONCE_INSTANCE_ID, id);
+}
+
+void Settings::setMiningNoncePartitionBits(quint32 bits)
+{
+    settings_->setValue(OPTION_MINING_NONCE_PARTITION_BITS, bits);
+}
+
+void Settings::setMiningAutoDifficultyEnabled(bool enabled)
+{
+    settings_->setValue(OPTION_MINING_AUTO_DIFFICULTY, enabled);
+}
+
+void Settings::setMiningSharesPerMinute(quint32 shares)
+{
+    settings_->setValue(OPTION_MINING_SHARES_PER_MINUTE, shares);
+}
+
+void Settings::setMiningDifficultyDriftThreshold(quint32 percent)
+{
+    settings_->setValue(OPTION_MINING_DIFFICULTY_DRIFT_THRESHOLD, percent);
+}
+
+void Settings::setMiningExcludedCpus(const QList<int>& cpus)
+{
+    QStringList value;
+    for (int cpu : cpus)
+        value.append(QString::number(cpu));
+
+    settings_->setValue(OPTION_MINING_EXCLUDED_CPUS, value);
+}
+
+void Settings::setMiningPoolList(const QStringList& pools)
+{
+    settings_->setValue(OPTION_MINING_POOL_LIST, pools);
+}
+
+void Settings::setMetricsPort(quint16 port)
+{
+    settings_->setValue(OPTION_METRICS_PORT, port);
+}
+
+void Settings::setTraceEnabled(bool enabled)
+{
+    settings_->setValue(OPTION_TRACE_ENABLED, enabled);
+}
+
+void Settings::setWalletFile(const QString& walletFile)
+{
+    settings_->setValue(OPTION_WALLET_FILE, walletFile);
+}
+
+void Settings::setRecentWallets(const QStringList& wallets)
+{
+    settings_->setValue(OPTION_RECENT_WALLETS, wallets);
+}
+
+void Settings::addRecentWallet(const QString& wallet)
+{
+    QStringList wallets = getRecentWallets();
+    wallets.removeOne(wallet);
+    wallets.push_front(wallet);
+    setRecentWallets(wallets);
+}
+
+void Settings::clearRecentWallets()
+{
+    setRecentWallets(QStringList());
+}
+
+/*static*/
+quint16 Settings::getDefaultRpcPort()
+{
+    return DEFAULT_LOCAL_RPC_PORT;
+}
+
+/*static*/
+QDir Settings::getDefaultWorkDir()
+{
+#if defined(Q_OS_WIN32)
+    return QStandardPaths::writableLocation(QStandardPaths::AppDataLocation);
+#elif defined(Q_OS_MAC)
+    return QStandardPaths::writableLocation(QStandardPaths::AppDataLocation);
+#elif defined(Q_OS_LINUX)
+    return QDir::homePath() + '/' + DEFAULT_WORK_DIR;
+#else
+    return QStandardPaths::writableLocation(QStandardPaths::AppDataLocation);
+#endif
+}
+
+///*static*/
+//QString Settings::getDefaultRpcPath()
+//{
+//    return DEFAULT_RPC_PATH;
+//}
+
+/*static*/
+QString Settings::getDefaultWalletdPath()
+{
+    const QString dir = QCoreApplication::applicationDirPath();
+#ifdef Q_OS_WIN32
+    return dir + '/' + "walletd.exe";
+#else
+    return dir + '/' + "walletd";
+#endif
+}
+
+/*static*/
+ConnectionMethod Settings::getDefaultConnectionMethod()
+{
+    return ConnectionMethod::BUILTIN;
+}
+
+/*static*/
+MiningPoolSwitchStrategy Settings::getDefaultMiningPoolSwitchStrategy()
+{
+    return MiningPoolSwitchStrategy::FAILOVER;
+}
+
+/*static*/
+quint32 Settings::getDefaultMiningCpuCoreCount()
+{
+    return (getCoreCount() +1) / 2;
+}
+
+/*static*/
+quint32 Settings::getDefaultMiningNonceBatchSize()
+{
+    return DEFAULT_MINING_NONCE_BATCH_SIZE;
+}
+
+/*static*/
+quint32 Settings::getDefaultMiningDutyCycle()
+{
+    return MAX_MINING_DUTY_CYCLE;
+}
+
+/*static*/
+void Settings::makeDataDir(const QDir& dataDir)
+{
+    if (!dataDir.exists())
+        dataDir.mkpath(dataDir.absolutePath());
+}
+
+/*static*/
+QStringList Settings::getDefaultMiningPoolList()
+{
+    QStringList result;
+    static constexpr size_t size = sizeof(DEFAULT_MINING_POOLS) / sizeof(DEFAULT_MINING_POOLS[0]);
+    std::copy(DEFAULT_MINING_POOLS, DEFAULT_MINING_POOLS + size, std::back_inserter(result));
+    return result;
+}
+
+/*static*/
+QString Settings::getVersion()
+{
+    return VERSION;
+}
+
+/*static*/
+QString Settings::getVersionSuffix()
+{
+    return VERSION_SUFFIX;
+}
+
+/*static*/
+QString Settings::getRevision()
+{
+    return REVISION;
+}
+
+/*static*/
+bool Settings::isStableVersion()
+{
+    return getVersionSuffix() == "stable";
+}
+
+void Settings::restoreDefaultPoolList()
+{
+    const auto defaultPoolList = getDefaultMiningPoolList();
+    if (!settings_->contains(OPTION_MINING_POOL_LIST))
+        setMiningPoolList(QStringList() << defaultPoolList);
+    else
+    {
+        QStringList poolList = getMiningPoolList();
+        for (const QString& pool : defaultPoolList)
+        {
+            if (!poolList.contains(pool))
+                poolList << pool;
+        }
+
+        setMiningPoolList(poolList);
+    }
+}
+
+QStringList Settings::getStringList(const QString& key, const QVariant& defaultValue) const
+{
+    return settings_->value(key, defaultValue).value<QStringList>();
+}
+
+bool Settings::connectionMethodSet() const
+{
+    return settings_->contains(OPTION_CONNECTION_METHOD);
+}
+
+
+}
@@ -1,96 +1,127 @@
-// Copyright (c) 2015-2018, The Bytecoin developers.
-// Licensed under the GNU Lesser General Public License. See LICENSE for details.
-
-#ifndef SETTINGS_H
-#define SETTINGS_H
-
-#include <QDir>
-#include <QSettings>
-
-namespace WalletGUI
-{
-
-enum class ConnectionMethod : int
-{
-    BUILTIN, LOCAL, REMOTE
-};
-
-enum class MiningPoolSwitchStrategy : int
-{
-    FAILOVER, RANDOM
-};
-
-class Settings : public QObject
-{
-    Q_OBJECT
-    Q_DISABLE_COPY(Settings)
-
-public:
-    static Settings& instance();
-
-    static quint16 getDefaultRpcPort();
-    static QDir getDefaultWorkDir();
-    static QString getDefaultWalletdPath();
-//    static QString getDefaultRpcPath();
-    static ConnectionMethod getDefaultConnectionMethod();
-    static MiningPoolSwitchStrategy getDefaultMiningPoolSwitchStrategy();
-    static quint32 getDefaultMiningCpuCoreCount();
-    static QStringList getDefaultMiningPoolList();
-    static QString getVersion();
-    static QString getVersionSuffix();
-    static QString getRevision();
-    static bool isStableVersion();
-
-    QSettings::Format getFormat() const;
-
-    quint16 getLocalRpcPort() const;
-    QString getRemoteRpcEndPoint() const;
-    QString getBuilinRpcEndPoint() const;
-    ConnectionMethod getConnectionMethod() const;
-    QString getUserFriendlyConnectionMethod() const;
-    QString getLocalRpcEndPoint() const;
-    QString getRpcEndPoint() const;
-    QString getWalletFile() const;
-
-    MiningPoolSwitchStrategy getMiningPoolSwitchStrategy() const;
-    quint32 getMiningCpuCoreCount() const;
-    QStringList getMiningPoolList() const;
-
-    QStringList getRecentWallets() const;
-
-    QStringList getWalletdParams() const;
-
-    void setWalletdParams(const QString& params);
-    void setLocalRpcPort(quint16 port);
-    void setRemoteRpcEndPoint(const QString& host, quint16 port);
-    void setConnectionMethod(ConnectionMethod method);
-
-    void setMiningPoolSwitchStrategy(MiningPoolSwitchStrategy strategy);
-    void setMiningCpuCoreCount(quint32 count);
-    void setMiningPoolList(const QStringList& pools);
-    void setWalletFile(const QString& walletFile);
-
-    void addRecentWallet(const QString& wallet);
-    void clearRecentWallets();
-
-    void restoreDefaultPoolList();
-
-    bool connectionMethodSet() const;
-
-signals:
-    void settingsChanged() const;
-
-private:
-    Settings();
-
-    static void makeDataDir(const QDir& dataDir);
-    QStringList getStringList(const QString& key, const QVariant& defaultValue) const;
-    void setRecentWallets(const QStringList& wallets);
-
-    QScopedPointer<QSettings> settings_;
-};
-
-}
-
-#endif // SETTINGS_H
-
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#ifndef SETTINGS_H
+#define SETTINGS_H
+
+#include <QDir>
+#include <QSettings>
+
+namespace WalletGUI
+{
+
+enum class ConnectionMethod : int
+{
+    BUILTIN, LOCAL, REMOTE
+};
+
+enum class MiningPoolSwitchStrategy : int
+{
+    FAILOVER, RANDOM, LATENCY
+};
+
+class Settings : public QObject
+{
+    Q_OBJECT
+    Q_DISABLE_COPY(Settings)
+
+public:
+    static Settings& instance();
+
+    static quint16 getDefaultRpcPort();
+    static QDir getDefaultWorkDir();
+    static QString getDefaultWalletdPath();
+//    static QString getDefaultRpcPath();
+    static ConnectionMethod getDefaultConnectionMethod();
+    static MiningPoolSwitchStrategy getDefaultMiningPoolSwitchStrategy();
+    static quint32 getDefaultMiningCpuCoreCount();
+    static quint32 getDefaultMiningNonceBatchSize();
+    static quint32 getDefaultMiningDutyCycle();
+    static QStringList getDefaultMiningPoolList();
+    static QString getVersion();
+    static QString getVersionSuffix();
+    static QString getRevision();
+    static bool isStableVersion();
+
+    QSettings::Format getFormat() const;
+
+    quint16 getLocalRpcPort() const;
+    QString getRemoteRpcEndPoint() const;
+    QString getBuilinRpcEndPoint() const;
+    ConnectionMethod getConnectionMethod() const;
+    QString getUserFriendlyConnectionMethod() const;
+    QString getLocalRpcEndPoint() const;
+    QString getRpcEndPoint() const;
+    QString getWalletFile() const;
+
+    MiningPoolSwitchStrategy getMiningPoolSwitchStrategy() const;
+    quint32 getMiningCpuCoreCount() const;
+    quint32 getMiningNonceBatchSize() const;
+    bool isMiningThreadPinningEnabled() const;
+    bool isMiningHotStandbyEnabled() const;
+    bool isMiningIdlePriorityEnabled() const;
+    int getMiningNiceLevel() const;
+    quint32 getMiningDutyCycle() const;
+    quint32 getMiningNonceInstanceId() const;
+    quint32 getMiningNoncePartitionBits() const;
+    bool isMiningAutoDifficultyEnabled() const;
+    quint32 getMiningSharesPerMinute() const;
+    quint32 getMiningDifficultyDriftThreshold() const;
+    QList<int> getMiningExcludedCpus() const;
+    QStringList getMiningPoolList() const;
+    // Port of the local Prometheus /metrics endpoint, 0 when it is off.
+    quint16 getMetricsPort() const;
+    bool isTraceEnabled() const;
+
+    QStringList getRecentWallets() const;
+
+    QStringList getWalletdParams() const;
+
+    void setWalletdParams(const QString& params);
+    void setLocalRpcPort(quint16 port);
+    void setRemoteRpcEndPoint(const QString& host, quint16 port);
+    void setConnectionMethod(ConnectionMethod method);
+
+    void setMiningPoolSwitchStrategy(MiningPoolSwitchStrategy strategy);
+    void setMiningCpuCoreCount(quint32 count);
+    void setMiningNonceBatchSize(quint32 size);
+    void setMiningThreadPinningEnabled(bool enabled);
+    void setMiningHotStandbyEnabled(bool enabled);
+    void setMiningIdlePriorityEnabled(bool enabled);
+    void setMiningNiceLevel(int level);
+    void setMiningDutyCycle(quint32 percent);
+    void setMiningNonceInstanceId(quint32 id);
+    void setMiningNoncePartitionBits(quint32 bits);
+    void setMiningAutoDifficultyEnabled(bool enabled);
+    void setMiningSharesPerMinute(quint32 shares);
+    void setMiningDifficultyDriftThreshold(quint32 percent);
+    void setMiningExcludedCpus(const QList<int>& cpus);
+    void setMiningPoolList(const QStringList& pools);
+    void setMetricsPort(quint16 port);
+    void setTraceEnabled(bool enabled);
+    void setWalletFile(const QString& walletFile);
+
+    void addRecentWallet(const QString& wallet);
+    void clearRecentWallets();
+
+    void restoreDefaultPoolList();
+
+    bool connectionMethodSet() const;
+
+signals:
+    void settingsChanged() const;
+
+private:
+    Settings();
+
+    static void makeDataDir(const QDir& dataDir);
+    QStringList getStringList(const QString& key, const QVariant& defaultValue) const;
+    void setRecentWallets(const QStringList& wallets);
+
+    QScopedPointer<QSettings> settings_;
+};
+
+}
+
+#endif // SETTINGS_H
+
@@ -1,35 +1,93 @@
-// Copyright (c) 2015-2018, The Bytecoin developers.
-// Licensed under the GNU Lesser General Public License. See LICENSE for details.
-
-#include <csignal>
-
-#include "signalhandler.h"
-#include "logger.h"
-
-namespace WalletGUI {
-
-SignalHandler& SignalHandler::instance()
-{
-    static SignalHandler inst;
-    return inst;
-}
-
-SignalHandler::SignalHandler()
-{
-    std::signal(SIGINT, SignalHandler::sigHandler);
-    std::signal(SIGTERM, SignalHandler::sigHandler);
-#ifndef Q_OS_WIN
-    std::signal(SIGPIPE, SIG_IGN);
-#endif
-}
-
-SignalHandler::~SignalHandler()
-{}
-
-void SignalHandler::sigHandler(int signal)
-{
-    WalletLogger::warning(tr("[SignalHandler] Signal received: %1").arg(signal));
-    emit SignalHandler::instance().quitSignal();
-}
-
-}
+// Copyright (c) 2015-2018, The Bytecoin developers.
+// Licensed under the GNU Lesser General Public License. See LICENSE for details.
+
+#include <csignal>
+
+#ifndef Q_OS_WIN
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <QSocketNotifier>
+#endif
+
+#include "signalhandler.h"
+#include "logger.h"
+
+namespace WalletGUI {
+
+namespace {
+
+#ifndef Q_OS_WIN
+// SIGUSR1 is passed from the signal handler to the event loop through a socket pair: writing to it is
+// async-signal-safe, emitting a Qt signal is not.
+int dumpTraceSockets[2] = {-1, -1};
+
+bool setNonBlocking(int fd)
+{
+    const int flags = ::fcntl(fd, F_GETFL);
+    return flags != -1 && ::fcntl(fd, F_SETFL, flags | O_NONBLOCK) != -1;
+}
+#endif
+
+}
+
+SignalHandler& SignalHandler::instance()
+{
+    static SignalHandler inst;
+    return inst;
+}
+
+SignalHandler::SignalHandler()
+    : dumpTraceNotifier_(nullptr)
+{
+    std::signal(SIGINT, SignalHandler::sigHandler);
+    std::signal(SIGTERM, SignalHandler::sigHandler);
+#ifndef Q_OS_WIN
+    std::signal(SIGPIPE, SIG_IGN);
+    // Both ends are non-blocking: a burst of signals must not stall the handler on a full socket, and
+    // draining must stop once the socket is empty.
+    if (::socketpair(AF_UNIX, SOCK_STREAM, 0, dumpTraceSockets) == 0 &&
+        setNonBlocking(dumpTraceSockets[0]) && setNonBlocking(dumpTraceSockets[1]))
+    {
+        dumpTraceNotifier_ = new QSocketNotifier(dumpTraceSockets[1], QSocketNotifier::Read, this);
+        connect(dumpTraceNotifier_, SIGNAL(activated(int)), this, SLOT(dumpTraceRequested()));
+        std::signal(SIGUSR1, SignalHandler::sigHandler);
+    }
+#endif
+}
+
+SignalHandler::~SignalHandler()
+{}
+
+void SignalHandler::sigHandler(int signal)
+{
+#ifndef Q_OS_WIN
+    if (signal == SIGUSR1)
+    {
+        const int savedErrno = errno;
+        const char request = 1;
+        const ssize_t written = ::write(dumpTraceSockets[0], &request, sizeof(request));
+        Q_UNUSED(written);
+        errno = savedErrno;
+        return;
+    }
+#endif
+
+    WalletLogger::warning(tr("[SignalHandler] Signal received: %1").arg(signal));
+    emit SignalHandler::instance().quitSignal();
+}
+
+void SignalHandler::dumpTraceRequested()
+{
+#ifndef Q_OS_WIN
+    // Several signals before the event loop gets here still mean a single dump.
+    char requests[16];
+    while (::read(dumpTraceSockets[1], requests, sizeof(requests)) > 0)
+        ;
+    emit dumpTraceSignal();
+#endif
+}
+
+}
@@ -1,12 +1,12 @@
-#ifndef VERSION_H
-#define VERSION_H
-
-namespace WalletGUI {
-
-constexpr char VERSION[] = "1.0.0";
-constexpr char VERSION_SUFFIX[] = "stable";
-constexpr char REVISION[] = "1";
-
-}
-
-#endif // VERSION_H
+#ifndef VERSION_H
+#define VERSION_H
+
+namespace WalletGUI {
+
+constexpr char VERSION[] = "1.0.0";
+constexpr char VERSION_SUFFIX[] = "stable";
+constexpr char REVISION[] = "1";
+
+}
+
+#endif // VERSION_H